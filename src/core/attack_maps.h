@@ -0,0 +1,77 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+
+#include <array>
+
+#include "util_hexchess.h"
+#include "variant.h"
+
+
+namespace hexchess::core {
+
+/// \brief Per-Color attack maps: the cells each piece attacks, the cells each Color attacks,
+///        and the number of each Color's pieces attacking each cell.
+///
+/// The owner (e.g., Board) keeps these up to date by calling setAttacksFrom whenever the
+/// attacks of the piece on a cell change. Only the difference from the previous attacks
+/// of that cell is applied, so an update costs time proportional to the cells that changed.
+template <typename Variant>
+class AttackMaps {
+public:
+    typedef Variant V;
+    using Bits = typename V::Bits;
+
+    /// \brief Sets the cells attacked by the piece of Color \p c at \p from, which may be
+    ///        none (i.e., empty Bits, e.g., when \p from has become empty).
+    void setAttacksFrom(Index from, Color c, const Bits& attacks) {
+        const Short ci = colorIndex(c);
+        Bits& prev = _attacksFrom[ci][from];
+        for (Index index : prev & ~attacks) {
+            assert(_attackerCounts[ci][index] > 0);
+            if (--_attackerCounts[ci][index] == 0) {
+                _attackedBits[ci].reset(index);
+            }
+        }
+        for (Index index : attacks & ~prev) {
+            if (_attackerCounts[ci][index]++ == 0) {
+                _attackedBits[ci].set(index);
+            }
+        }
+        prev = attacks;
+    }
+
+    /// \brief Returns the cells attacked by the piece of Color \p c at \p from (if any).
+    const Bits& attacksFrom(Index from, Color c) const { return _attacksFrom[colorIndex(c)][from]; }
+
+    /// \brief Returns the cells attacked by at least one piece of Color \p c.
+    const Bits& attackedBits(Color c) const { return _attackedBits[colorIndex(c)]; }
+
+    /// \brief Returns the number of pieces of Color \p c that attack \p index.
+    Short attackerCount(Index index, Color c) const { return _attackerCounts[colorIndex(c)][index]; }
+
+    friend bool operator==(const AttackMaps& a, const AttackMaps& b) = default;
+
+private:
+    std::array<std::array<Bits, V::CELL_COUNT>, V::COLOR_COUNT> _attacksFrom{};
+    std::array<Bits, V::COLOR_COUNT> _attackedBits{};
+    std::array<std::array<std::uint8_t, V::CELL_COUNT>, V::COLOR_COUNT> _attackerCounts{};
+};
+
+}  // namespace hexchess::core
@@ -15,6 +15,8 @@
 
 #include <cctype>
 
+#include <algorithm>
+#include <iterator>
 #include <map>
 #include <set>
 #include <sstream>
@@ -47,37 +49,108 @@ namespace hexchess::core {
 
 using player::Player;
 
+// ========================================
+// Attack maps
+
+template<>
+typename Glinski::Bits Board<Glinski>::pieceAttacks(Index from, Color c, PieceType pt) const {
+    switch (pt) {
+    case PieceType::King:
+        return V::kingAttacks[from];
+    case PieceType::Queen:
+    case PieceType::Rook:
+    case PieceType::Bishop:
+        return SliderAttacks<V>::attacks(pt, from, anyPieceBits());
+    case PieceType::Knight:
+        return V::knightAttacks[from];
+    case PieceType::Pawn:
+        return V::pawnAttacks[colorIndex(c)][from];
+    default:
+        throw std::logic_error{"Board::pieceAttacks: Unrecognized PieceType"};
+    }
+}
+
+/// \brief Only the piece on \p index, and the sliders that attack \p index (i.e., whose lines
+///        reach it, whether it is now empty or occupied), can have different attacks.
+template<>
+void Board<Glinski>::_attackMapsUpdate(Index index) {
+    using SA = SliderAttacks<V>;
+    if (!_optAttackMaps.has_value()) {
+        return;
+    }
+    AttackMaps<V>& maps = _optAttackMaps.value();
+
+    const PieceCode code = _pos.mailbox[index];
+    for (Color c : {Color::Black, Color::White}) {
+        maps.setAttacksFrom(index, c,
+            code != noPieceCode && pieceCodeColor(code) == c
+                ? pieceAttacks(index, c, pieceCodePieceType(code))
+                : typename V::Bits{});
+    }
+
+    auto both = [this](PieceType pt) {
+        return pieceBits(Color::Black, pt) | pieceBits(Color::White, pt);
+    };
+    const auto queens = both(PieceType::Queen);
+    const auto sliders = (SA::rookAttacks(index, anyPieceBits()) & (queens | both(PieceType::Rook)))
+                       | (SA::bishopAttacks(index, anyPieceBits()) & (queens | both(PieceType::Bishop)));
+    for (Index from : sliders) {
+        const Color c = pieceCodeColor(_pos.mailbox[from]);
+        maps.setAttacksFrom(from, c, pieceAttacks(from, c, pieceCodePieceType(_pos.mailbox[from])));
+    }
+}
+
+template<>
+AttackMaps<Glinski> Board<Glinski>::attackMapsRecompute() const {
+    AttackMaps<V> result{};
+    for (Index from : anyPieceBits()) {
+        const PieceCode code = _pos.mailbox[from];
+        const Color c = pieceCodeColor(code);
+        result.setAttacksFrom(from, c, pieceAttacks(from, c, pieceCodePieceType(code)));
+    }
+    return result;
+}
+
+template<>
+void Board<Glinski>::setIsTrackingAttacks(bool isTracking) {
+    _optAttackMaps = isTracking ? std::make_optional(attackMapsRecompute()) : std::nullopt;
+}
+
+template<>
+typename Glinski::Bits Board<Glinski>::attackedBits(Color c) const {
+    if (_optAttackMaps.has_value()) {
+        return _optAttackMaps.value().attackedBits(c);
+    }
+    typename V::Bits result{};
+    for (Index from : anyPieceBits(c)) {
+        result |= pieceAttacks(from, c, pieceCodePieceType(_pos.mailbox[from]));
+    }
+    return result;
+}
+
+/// \brief Asserts (in debug builds only) that the tracked attack maps (if any)
+///        match those computed from scratch.
+template<>
+void Board<Glinski>::_attackMapsConsistencyTest() const {
+    assert(!_optAttackMaps.has_value() || _optAttackMaps.value() == attackMapsRecompute());
+}
+
 // ========================================
 // Constructor support
 
 // Note: Does not check prior status of Board
 template<>
 void Board<Glinski>::setPiece(Index index, Color c, PieceType pt, bool value) {
-    _anyPieceBits[index] = value;
-    _colorToAnyPieceBits[c][index] = value;
+    assert(pieceTypeIndex(pt) >= 0 && pieceTypeIndex(pt) < V::PIECE_TYPE_COUNT);
 
-    switch(pt) {
-    case PieceType::Pawn:
-        _colorToPawnBits[c][index] = value;
-        break;
-    case PieceType::Knight:
-        _colorToKnightBits[c][index] = value;
-        break;
-    case PieceType::Bishop:
-        _colorToBishopBits[c][index] = value;
-        break;
-    case PieceType::Rook:
-        _colorToRookBits[c][index] = value;
-        break;
-    case PieceType::Queen:
-        _colorToQueenBits[c][index] = value;
-        break;
-    case PieceType::King:
-        _colorToKingBits[c][index] = value;
-        break;
-    default:
-        throw std::logic_error("Board<Glinski>::setPiece: Unrecognized piece type");
+    if (pieceBits(c, pt).test(index) != value) {
+        _pos.zHash ^= Zobrist<V>::getZHash(index, c, pt);
     }
+    _pos.anyPieceBits.set(index, value);
+    _pos.colorBits[colorIndex(c)].set(index, value);
+    _pos.pieceBits[colorIndex(c)][pieceTypeIndex(pt)].set(index, value);
+    _pos.mailbox[index] = value ? pieceCode(c, pt) : noPieceCode;
+    _attackMapsUpdate(index);
 }
 
 template<>
@@ -94,6 +167,9 @@ template<>
 void Board<Glinski>::movePiece(Index from, Index to, Color c, PieceType pt) {
     setPiece(from, c, pt, false);
     setPiece(to, c, pt, true);
+    if (pt == PieceType::King) {
+        setKingIndex(to, c);
+    }
 }
 
 template<>
@@ -104,7 +180,21 @@ void Board<Glinski>::changePieceType(Index index, Color c, PieceType ptOld, Piec
 
 template<>
 HalfMoveCounter Board<Glinski>::currentCounter() const {
-    return _currentCounter;
+    return _pos.currentCounter;
+}
+
+/// \brief Sets the side to move, keeping the Zobrist hash in sync.
+template<>
+void Board<Glinski>::_setMover(Color mover) {
+    _pos.zHash ^= Zobrist<V>::getMoverZHash(_pos.mover) ^ Zobrist<V>::getMoverZHash(mover);
+    _pos.mover = mover;
+}
+
+/// \brief Sets the en passant cell (if any), keeping the Zobrist hash in sync.
+template<>
+void Board<Glinski>::_setOptEpIndex(OptIndex optEpIndex) {
+    _pos.zHash ^= Zobrist<V>::getEpZHash(_pos.optEpIndex) ^ Zobrist<V>::getEpZHash(optEpIndex);
+    _pos.optEpIndex = optEpIndex;
 }
 
 template<>
@@ -123,12 +213,12 @@ void Board<Glinski>::initialize(const Fen<Glinski>& fen) {
         }
     }
     // (2) Mover
-    _mover = fen.mover;
+    _setMover(fen.mover);
     // (3) TODO: Castling availability
     // (4) En passant avaiability
-    _optEpIndex = fen.optEpIndex;
+    _setOptEpIndex(fen.optEpIndex);
     // (5) Half-move (ply) clock
-    _currentCounter = fen.currentCounter;
+    _pos.currentCounter = fen.currentCounter;
     // (6) Full move number (not needed)
 }
 
@@ -142,26 +232,13 @@ void Board<Glinski>::initialize(const Fen<Glinski>& fen) {
 /// For a board with custom setup, use Board(const Fen<V> initial setup: Board()
 template<>
 Board<Glinski>::Board(const string& name, bool doPopulate)
-    : _name{name}
+    : _name{name},
+      _pos{}
 {
-    _anyPieceBits = V::Bits{};
-    _colorToAnyPieceBits = map<Color, typename V::Bits> {
-        { Color::Black, {}}, {Color::White, {}} };
-    _colorToKingBits     = map<Color, typename V::Bits> {
-        { Color::Black, {}}, {Color::White, {}} };
-    _colorToQueenBits    = map<Color, typename V::Bits> {
-        { Color::Black, {}}, {Color::White, {}} };
-    _colorToRookBits     = map<Color, typename V::Bits> {
-        { Color::Black, {}}, {Color::White, {}} };
-    _colorToBishopBits   = map<Color, typename V::Bits> {
-        { Color::Black, {}}, {Color::White, {}} };
-    _colorToKnightBits   = map<Color, typename V::Bits> {
-        { Color::Black, {}}, {Color::White, {}} };
-    _colorToPawnBits     = map<Color, typename V::Bits> {
-        { Color::Black, {}}, {Color::White, {}} };
-
-    _colorToKingIndex    = map<Color, Index> { { Color::Black, 12345}, {Color::White, 12345} };
-    _optEpIndex          = std::nullopt;
+    for (Color c : {Color::Black, Color::White}) {
+        setKingIndex(12345, c);
+    }
+    _pos.optEpIndex          = std::nullopt;
 
     if (doPopulate) {
         Fen<V> fenInitial{Glinski::fenInitial};
@@ -191,17 +268,17 @@ Board<Glinski>::Board(const string& name, const Fen<V>& fen)
     }
 
     // Part (2) of FEN string: Active color
-    _mover = fen.mover;
+    _setMover(fen.mover);
 
     // Part (3) of FEN string: Castling availability: TODO
     // _colorToRookCastlingAvailabilityBits[Color::Black].set(k);
     // _colorToRookCastlingAvailabilityBits[Color::White].set(k);
 
     // Part (4) of FEN string: En passant
-    _optEpIndex = std::nullopt;
+    _setOptEpIndex(fen.optEpIndex);
 
     // Part (5) of FEN string: Half move clock
-    _currentCounter = fen.currentCounter;
+    _pos.currentCounter = fen.currentCounter;
 
     // Part (6) of FEN string: Full move counter
     // Not needed
@@ -213,23 +290,30 @@ Board<Glinski>::Board(const string& name, const string& fenStr)
     : Board<Glinski>::Board{name, Fen<V>{fenStr}}
 { /* TODO */ }
 
+/// \brief Constructs Board from a Position (e.g., one handed over from another thread).
+///        The Board has no game history before that Position.
+template<>
+Board<Glinski>::Board(const string& name, const Position<V>& pos)
+    : _name{name},
+      _pos{pos}
+{ }
+
 // ========================================
 // Fundamental operations
 
 template<>
 void Board<Glinski>::clear() {
-    _anyPieceBits.reset();
+    _pos.anyPieceBits.reset();
 
     for (Color c : {Color::Black, Color::White}) {
-        _colorToAnyPieceBits[c].reset();
-        _colorToKingBits[c].reset();
-        _colorToQueenBits[c].reset();
-        _colorToRookBits[c].reset();
-        _colorToBishopBits[c].reset();
-        _colorToKnightBits[c].reset();
-        _colorToPawnBits[c].reset();
-    }
-    _optEpIndex = std::nullopt;
+        _pos.colorBits[colorIndex(c)].reset();
+        for (PieceType pt : pieceTypes) {
+            _pos.pieceBits[colorIndex(c)][pieceTypeIndex(pt)].reset();
+        }
+    }
+    std::fill(std::begin(_pos.mailbox), std::end(_pos.mailbox), noPieceCode);
+    _pos.optEpIndex = std::nullopt;
+    _pos.zHash = Zobrist<V>::getMoverZHash(_pos.mover);
     /// \todo: Support castling: Have Board<>::clear() modfy _castlingBits
 }
 
@@ -270,15 +354,13 @@ void Board<Glinski>::reset(bool doPopulate) {
 
 template<>
 Color Board<Glinski>::getColorAt(Index index) const {
-    if (!anyPieceBits().test(index)) {
+    if (_pos.mailbox[index] == noPieceCode) {
         ostringstream oss;
         oss << "Board::getColorAt: No piece at " << index;
         string msg = oss.str();
         throw std::logic_error{msg};
     }
-    return anyPieceBits(Color::Black).test(index)
-        ? Color::Black
-        : Color::White;
+    return pieceCodeColor(_pos.mailbox[index]);
 }
 
 template<>
@@ -301,23 +383,14 @@ const string Board<Glinski>::board_bits_string() const {
     }
     oss << "\n";
 
-    oss << "Any Piece : " << reved(_anyPieceBits.to_string())  << "\n";
-    oss << "    Black:\n";
-    oss << "\tA:  " << reved(_colorToAnyPieceBits.at(Color::Black).to_string()) << "\n";
-    oss << "\tK:  " << reved(_colorToKingBits.at(Color::Black).to_string())     << "\n";
-    oss << "\tQ:  " << reved(_colorToQueenBits.at(Color::Black).to_string())    << "\n";
-    oss << "\tR:  " << reved(_colorToRookBits.at(Color::Black).to_string())     << "\n";
-    oss << "\tB:  " << reved(_colorToBishopBits.at(Color::Black).to_string())   << "\n";
-    oss << "\tN:  " << reved(_colorToKnightBits.at(Color::Black).to_string())   << "\n";
-    oss << "\tP:  " << reved(_colorToPawnBits.at(Color::Black).to_string())     << "\n";
-    oss << "    White:\n";
-    oss << "\tA:  " << reved(_colorToAnyPieceBits.at(Color::White).to_string()) << "\n";
-    oss << "\tK:  " << reved(_colorToKingBits.at(Color::White).to_string())     << "\n";
-    oss << "\tQ:  " << reved(_colorToQueenBits.at(Color::White).to_string())    << "\n";
-    oss << "\tR:  " << reved(_colorToRookBits.at(Color::White).to_string())     << "\n";
-    oss << "\tB:  " << reved(_colorToBishopBits.at(Color::White).to_string())   << "\n";
-    oss << "\tN:  " << reved(_colorToKnightBits.at(Color::White).to_string())   << "\n";
-    oss << "\tP:  " << reved(_colorToPawnBits.at(Color::White).to_string())     << "\n";
+    oss << "Any Piece : " << reved(_pos.anyPieceBits.to_string())  << "\n";
+    for (Color c : {Color::Black, Color::White}) {
+        oss << "    " << color_long_string(c) << ":\n";
+        oss << "\tA:  " << reved(anyPieceBits(c).to_string()) << "\n";
+        for (PieceType pt : pieceTypes) {
+            oss << "\t" << pt << ":  " << reved(pieceBits(c, pt).to_string()) << "\n";
+        }
+    }
 
     return oss.str();
 }
@@ -329,23 +402,12 @@ PieceType Board<Glinski>::getPieceTypeAt(Index index, Color c) const {
     }
     assert(anyPieceBits(c).test(index));
 
-    if (pawnBits(c).test(index)) {
-        return PieceType::Pawn;
-    } else if (knightBits(c).test(index)) {
-        return PieceType::Knight;
-    } else if (bishopBits(c).test(index)) {
-        return PieceType::Bishop;
-    } else if (rookBits(c).test(index)) {
-        return PieceType::Rook;
-    } else if (queenBits(c).test(index)) {
-        return PieceType::Queen;
-    } else /* King */ {
-        if (!kingBits(c).test(index)) {
-            throw std::logic_error("Inconsistent board information on cell #"
-                + std::to_string(index));
-        }
-        return PieceType::King;
+    PieceCode code = _pos.mailbox[index];
+    if (code == noPieceCode || pieceCodeColor(code) != c) {
+        throw std::logic_error("Inconsistent board information on cell #"
+            + std::to_string(index));
     }
+    return pieceCodePieceType(code);
 }
 
 template<>
@@ -357,12 +419,9 @@ template<>
 PiecesDense Board<Glinski>::piecesDense() const {
     PiecesDense result{};
 
-    for (Index index = 0; index < V::CELL_COUNT; ++index) {
-        if (isPieceAt(index)) {
-            Color c = getColorAt(index);
-            PieceType pt = getPieceTypeAt(index, c);
-            result.push_back(std::make_tuple(index, c, pt));
-        }
+    for (Index index : anyPieceBits()) {
+        PieceCode code = _pos.mailbox[index];
+        result.push_back(std::make_tuple(index, pieceCodeColor(code), pieceCodePieceType(code)));
     }
     return result;
 }
@@ -372,13 +431,8 @@ template<>
 PiecesDense Board<Glinski>::piecesDense(Color c) const {
     PiecesDense result{};
 
-    for (Index index = 0; index < V::CELL_COUNT; ++index) {
-        if (isPieceAt(index)) {
-            if (getColorAt(index) == c) {
-                PieceType pt = getPieceTypeAt(index, c);
-                result.push_back(std::make_tuple(index, c, pt));
-            }
-        }
+    for (Index index : anyPieceBits(c)) {
+        result.push_back(std::make_tuple(index, c, pieceCodePieceType(_pos.mailbox[index])));
     }
     return result;
 }
@@ -388,10 +442,9 @@ PiecesSparse Board<Glinski>::piecesSparse() const {
     PiecesSparse result{};
 
     for (Index index = 0; index < V::CELL_COUNT; ++index) {
-        if (isPieceAt(index)) {
-            Color c = getColorAt(index);
-            PieceType pt = getPieceTypeAt(index, c);
-            result.push_back(mkPair(c, pt));
+        PieceCode code = _pos.mailbox[index];
+        if (code != noPieceCode) {
+            result.push_back(mkPair(pieceCodeColor(code), pieceCodePieceType(code)));
         } else {
             result.push_back(std::nullopt);
         }
@@ -401,28 +454,36 @@ PiecesSparse Board<Glinski>::piecesSparse() const {
 
 template<>
 const Fen<Glinski> Board<Glinski>::fen() const {
-    return Fen<V>{piecesSparse(), _mover, _optEpIndex, _currentCounter};
+    return Fen<V>{piecesSparse(), _pos.mover, _pos.optEpIndex, _pos.currentCounter};
 }
 
 // ========================================
 // Board hashing
 
 template<>
-ZHash Board<Glinski>::zobristHash() const {
-    ZHash result = 0;
-    for (Index index = 0; index < V::CELL_COUNT; ++index) {
-        if (!isEmpty(index)) {
-            Color c = getColorAt(index);
-            PieceType pt = getPieceTypeAt(index, c);
-            result ^= Zobrist<V>::getZHash(index, c, pt);
-        }
+ZHash Board<Glinski>::zobristHashRecompute() const {
+    ZHash result = Zobrist<V>::getMoverZHash(_pos.mover) ^ Zobrist<V>::getEpZHash(_pos.optEpIndex);
+    for (Index index : anyPieceBits()) {
+        PieceCode code = _pos.mailbox[index];
+        result ^= Zobrist<V>::getZHash(index, pieceCodeColor(code), pieceCodePieceType(code));
     }
     return result;
 }
 
+/// Only positions since the last capture or Pawn move can recur, and only those with the
+/// same mover, so the hash history is scanned backwards two plies at a time, at most
+/// nonProgressCounter plies back.
 template<>
-bool Board<Glinski>::isRepetition() const {
-    throw NotImplementedException{};
+bool Board<Glinski>::isRepetition(Short priorCount) const {
+    const Size historySize = _zHashes.size();
+    const Size reach = std::min(historySize, static_cast<Size>(_pos.nonProgressCounter));
+    Short count = 0;
+    for (Size back = 2; back <= reach; back += 2) {
+        if (_zHashes[historySize - back] == _pos.zHash && ++count >= priorCount) {
+            return true;
+        }
+    }
+    return false;
 }
 
 // ========================================
@@ -450,12 +511,11 @@ const string Board<Glinski>::board_string() const {
     // oss << "indent=" << std::setw(2) << indent(0) << ": "
     oss << std::setw(indent(0)) << " ";
     for (Index index : Glinski::fenOrderToIndex) {
-        if (isEmpty(index)) {
+        PieceCode code = _pos.mailbox[index];
+        if (code == noPieceCode) {
             oss << "  --";
         } else {
-            Color c = getColorAt(index);
-            PieceType pt = getPieceTypeAt(index, c);
-            oss << "  " << piece_string(c, pt);
+            oss << "  " << piece_string(pieceCodeColor(code), pieceCodePieceType(code));
         }
         cellsRemainingInRow--;
 
@@ -500,50 +560,29 @@ const string Board<Glinski>::moves_pgn_string() const {
     return oss.str();
 }
 
+/// \brief Asserts that no cell holds more than one piece, that the
+///        per-Color and any-piece occupancy agree with the per-PieceType bits,
+///        and that the mailbox agrees with the bits.
 template<>
 void Board<Glinski>::_bitsConsistencyTest() const {
-    for (Index index = 0; index < Glinski::CELL_COUNT; ++index) {
-        Short pieceFoundCount = 0;
-        for (Color c : {Color::Black, Color::White}) {
-            Short thisColorPieceFoundCount = 0;
-            if (_colorToKingBits.at(c).test(index)) {
-                thisColorPieceFoundCount++;
-            }
-            if (_colorToQueenBits.at(c).test(index)) {
-                thisColorPieceFoundCount++;
-            }
-            if (_colorToRookBits.at(c).test(index)) {
-                thisColorPieceFoundCount++;
-            }
-            if (_colorToBishopBits.at(c).test(index)) {
-                thisColorPieceFoundCount++;
-            }
-            if (_colorToKnightBits.at(c).test(index)) {
-                thisColorPieceFoundCount++;
-            }
-            if (_colorToPawnBits.at(c).test(index)) {
-                thisColorPieceFoundCount++;
-            }
-
-            assert(thisColorPieceFoundCount <= 1);
-            if (thisColorPieceFoundCount > 0) {
-                assert(_colorToAnyPieceBits.at(c).test(index));
-            }
-            pieceFoundCount += thisColorPieceFoundCount;
-        }
-        assert(pieceFoundCount <= 1);
-        if (pieceFoundCount > 0) {
-            assert(_anyPieceBits.test(index));
+    V::Bits allColorsBits{};
+    for (Color c : {Color::Black, Color::White}) {
+        V::Bits colorBits{};
+        for (PieceType pt : pieceTypes) {
+            assert((colorBits & pieceBits(c, pt)).none());
+            colorBits |= pieceBits(c, pt);
         }
+        assert(colorBits == anyPieceBits(c));
+        assert((allColorsBits & colorBits).none());
+        allColorsBits |= colorBits;
+    }
+    assert(allColorsBits == _pos.anyPieceBits);
+    for (Index index = 0; index < V::CELL_COUNT; ++index) {
+        PieceCode code = _pos.mailbox[index];
+        assert(code == noPieceCode
+            ? !_pos.anyPieceBits.test(index)
+            : pieceBits(pieceCodeColor(code), pieceCodePieceType(code)).test(index));
     }
-}
-
-template<>
-void Board<Glinski>::_bitsMove(map<Color, typename Glinski::Bits>& bits,
-    Color mover, Index from, Index to)
-{
-    bits[mover].reset(from);
-    bits[mover].set(to);
 }
 
 template<>
@@ -557,197 +596,257 @@ void Board<Glinski>::_bitsMove(typename Glinski::Bits& bits,
 template<>
 void Board<Glinski>::_bitsReset(Index index, Color c, PieceType pt) {
     assert(getColorAt(index) == c);
-    _anyPieceBits.reset(index);
-    _colorToAnyPieceBits[c].reset(index);
-    _colorToKingBits[c].reset(index);
-    _colorToQueenBits[c].reset(index);
-    _colorToRookBits[c].reset(index);
-    _colorToBishopBits[c].reset(index);
-    _colorToKnightBits[c].reset(index);
-    _colorToPawnBits[c].reset(index);
+    _pos.anyPieceBits.reset(index);
+    _pos.colorBits[colorIndex(c)].reset(index);
+    _pos.pieceBits[colorIndex(c)][pieceTypeIndex(pt)].reset(index);
+    _pos.mailbox[index] = noPieceCode;
+    _pos.zHash ^= Zobrist<V>::getZHash(index, c, pt);
+    _attackMapsUpdate(index);
+}
+
+template<>
+void Board<Glinski>::_bitsSet(Index index, Color c, PieceType pt) {
+    bool debug{false};  // Called for every make and unmake
+    if (debug) {
+        assert(!isPieceAt(index));
+    }
+    _pos.anyPieceBits.set(index);
+    _pos.colorBits[colorIndex(c)].set(index);
+    _pos.pieceBits[colorIndex(c)][pieceTypeIndex(pt)].set(index);
+    _pos.mailbox[index] = pieceCode(c, pt);
+    _pos.zHash ^= Zobrist<V>::getZHash(index, c, pt);
+    _attackMapsUpdate(index);
+}
+
+template<>
+void Board<Glinski>::_bitsMovePiece(Index from, Index to, Color c, PieceType pt) {
+    bool debug{false};  // Called for every make and unmake
+    if (debug) {
+        assert(getColorAt(from) == c && !isPieceAt(to));
+    }
+    _bitsMove(_pos.anyPieceBits, from, to);
+    _bitsMove(_pos.colorBits[colorIndex(c)], from, to);
+    _bitsMove(_pos.pieceBits[colorIndex(c)][pieceTypeIndex(pt)], from, to);
+    _pos.mailbox[to] = _pos.mailbox[from];
+    _pos.mailbox[from] = noPieceCode;
+    _pos.zHash ^= Zobrist<V>::getZHash(from, c, pt) ^ Zobrist<V>::getZHash(to, c, pt);
+    _attackMapsUpdate(from);
+    _attackMapsUpdate(to);
+    if (pt == PieceType::King) {
+        setKingIndex(to, c);
+    }
+}
+
+template<>
+void Board<Glinski>::_makeMovePieces(const Move& move) {
+    const Color opp = opponent(move.mover());
+    if (move.isCapture()) {
+        Index capInd = move.isEnPassant()
+                     ? V::neighbor(move.to(), V::pawnAdvanceDirIndex(opp))
+                     : move.to();
+        _bitsReset(capInd, opp, move.optCaptured().value());
+    }
+    _bitsMovePiece(move.from(), move.to(), move.mover(), move.pieceType());
+    if (move.isPromotion()) {
+        _bitsReset(move.to(), move.mover(), PieceType::Pawn);
+        _bitsSet(move.to(), move.mover(), move.optPromotedTo().value());
+    }
+}
+
+template<>
+void Board<Glinski>::_unmakeMovePieces(const Move& move) {
+    const Color opp = opponent(move.mover());
+    if (move.isPromotion()) {
+        _bitsReset(move.to(), move.mover(), move.optPromotedTo().value());
+        _bitsSet(move.to(), move.mover(), PieceType::Pawn);
+    }
+    _bitsMovePiece(move.to(), move.from(), move.mover(), move.pieceType());
+    if (move.isCapture()) {
+        Index capInd = move.isEnPassant()
+                     ? V::neighbor(move.to(), V::pawnAdvanceDirIndex(opp))
+                     : move.to();
+        _bitsSet(capInd, opp, move.optCaptured().value());
+    }
 }
 
+/// \brief Asserts (in debug builds only) that the incrementally maintained
+///        Zobrist hash matches one computed from scratch.
+template<>
+void Board<Glinski>::_zobristConsistencyTest() const {
+    assert(_pos.zHash == zobristHashRecompute());
+}
+
+
 // ========================================
 // Finding pseudo-legal moves
 
 template<>
-void Board<Glinski>::recordObstructedHexRayCore(
-    Index obsIndex, Index rayStart, const HexDir& rayDir) cache_const
+typename Glinski::Bits Board<Glinski>::attackersTo(
+    Index tgtIndex, const typename Glinski::Bits& occupancy) const
 {
-    Scope scope{"Board::recordObstructedHexRayCore"};
-    // print(cout, scope(), "Previously cached obstructions: ", _cache.obstructedHexRayMap.size(), "\n");
-    // print(cout, scope(), "Adding obstruction @ ", obsIndex, " for ray start=", rayStart, ", dir=", rayDir, "\n");
-    assert(rayDir.hex0 != 0 || rayDir.hex1 != 0);
-    if (!_cache.obstructedHexRayMap.contains(obsIndex)) {
-        _cache.obstructedHexRayMap[obsIndex] = HexRayCores{};
-    }
-    auto hexRayCore = mkPair(rayStart, rayDir);
-    _cache.obstructedHexRayMap[obsIndex].push_back(hexRayCore);
+    using SA = SliderAttacks<V>;
+    auto both = [this](PieceType pt) {
+        return pieceBits(Color::Black, pt) | pieceBits(Color::White, pt);
+    };
+    const auto queens = both(PieceType::Queen);
+    // A Pawn of one Color attacks tgtIndex iff a Pawn of the other Color on tgtIndex
+    // would attack that Pawn's cell.
+    return (V::kingAttacks[tgtIndex] & both(PieceType::King))
+         | (V::knightAttacks[tgtIndex] & both(PieceType::Knight))
+         | (V::pawnAttacks[colorIndex(Color::White)][tgtIndex] & pawnBits(Color::Black))
+         | (V::pawnAttacks[colorIndex(Color::Black)][tgtIndex] & pawnBits(Color::White))
+         | (SA::rookAttacks(tgtIndex, occupancy) & (queens | both(PieceType::Rook)))
+         | (SA::bishopAttacks(tgtIndex, occupancy) & (queens | both(PieceType::Bishop)));
 }
 
 template<>
-const HexRayCores Board<Glinski>::getObstructedHexRayCores(Index obsIndex) cache_const {
-    if (_cache.obstructedHexRayMap.contains(obsIndex)) {
-        return _cache.obstructedHexRayMap.at(obsIndex);
-    } else {
-        // TODO
-        return HexRayCores{};
-    }
+typename Glinski::Bits Board<Glinski>::attackersTo(
+    Index tgtIndex, Color attacker, const typename Glinski::Bits& occupancy) const
+{
+    using SA = SliderAttacks<V>;
+    // A Pawn of Color attacker attacks tgtIndex iff a Pawn of the other Color on tgtIndex
+    // would attack that Pawn's cell.
+    return (V::kingAttacks[tgtIndex] & kingBits(attacker))
+         | (V::knightAttacks[tgtIndex] & knightBits(attacker))
+         | (V::pawnAttacks[colorIndex(opponent(attacker))][tgtIndex] & pawnBits(attacker))
+         | (SA::rookAttacks(tgtIndex, occupancy) & (queenBits(attacker) | rookBits(attacker)))
+         | (SA::bishopAttacks(tgtIndex, occupancy) & (queenBits(attacker) | bishopBits(attacker)));
+}
+
+template<>
+typename Glinski::Bits Board<Glinski>::attackersTo(Index tgtIndex, Color attacker) const {
+    return attackersTo(tgtIndex, attacker, anyPieceBits());
 }
 
 template<>
-void Board<Glinski>::findLeapMoves(/* out */ Moves& moves,
-    Index from, Color mover, PieceType pt, const Indices& dests
+bool Board<Glinski>::isOwnCellAttacked(Index tgtIndex) cache_const {
+    return attackersTo(tgtIndex, opponent(mover())).any();
+}
+
+template<>
+void Board<Glinski>::findLeapMoves(/* out */ VariantMoveList& moves,
+    Index from, Color mover, PieceType pt, const typename Glinski::Bits& attacks
     ) const
 {
-    transform_push_back_if(dests.begin(), dests.end(), moves,
-        [=](Index dest) { return !isPieceAt(dest, mover); },  // Cannot capture own piece
-        [&](Index dest) {
-            return Move { mover, pt, from, dest,
-                          MoveEnum::Simple,
-                          isPieceAt(dest, opponent(mover))  // Not a Pawn promotion
-                              ? std::make_optional(getPieceTypeAt(dest, opponent(mover)))
-                              : std::nullopt,
-                          std::nullopt,  // Not a Pawn promotion
-                          std::nullopt
-                        };
-            }
-        );
+    // Cannot capture own piece
+    for (Index dest : attacks & ~anyPieceBits(mover)) {
+        PieceCode destCode = pieceCodeAt(dest);
+        moves.push_back(Move{ mover, pt, from, dest,
+                              MoveEnum::Simple,
+                              destCode != noPieceCode
+                                  ? std::make_optional(pieceCodePieceType(destCode))
+                                  : std::nullopt,
+                              std::nullopt,  // Not a Pawn promotion
+                              std::nullopt
+                            });
+    }
 }
 
 template<>
-void Board<Glinski>::findSlideMoves(
-    /* out */ Moves& moves,
-    Index from,
-    Color mover,
-    PieceType pt,
-    const HexRays<Glinski>& rays,
-    bool isVirtual
+void Board<Glinski>::findSlideMoves(/* out */ VariantMoveList& moves,
+    Index from, Color mover, PieceType pt
     ) const
 {
-    for (const HexRay<V>& ray : rays) {
-        bool foundObstruction = false;
-        Color obstructionColor = Color::Black;
-
-        for (Index dest : ray.indices()) {
-            if (isPieceAt(dest)
-                && V::isOnBoard(V::indexToPos(dest)))
-            {
-                foundObstruction = true;
-                if (!isVirtual) {
-                    recordObstructedHexRayCore(dest, ray.start(), ray.dir());
-                }
-                Color destColor = getColorAt(dest);
-                if (destColor == mover) {
-                    obstructionColor = destColor;
-                    break;
-                }
-            }
-            if (!foundObstruction || obstructionColor != mover) {
-                Move move{ mover, pt, from, dest,
-                        MoveEnum::Simple,
-                        isPieceAt(dest, opponent(mover))
-                            ? std::make_optional(getPieceTypeAt(dest, opponent(mover)))
-                            : std::nullopt,
-                        std::nullopt,  // Not a Pawn promotion
-                        std::nullopt  // Unknown Check type
-                    };
-                moves.push_back(move);
-            }
-            if (foundObstruction) {
-                break;
-            }
-        }
-    }
+    findLeapMoves(moves, from, mover, pt, SliderAttacks<V>::attacks(pt, from, anyPieceBits()));
 }
 
-/// \brief Find available (non-en-passant) Pawn moves. For Pawn promotion scenarios,
-///        create multiple moves, one for each Pawn promotion type.
+/// \brief Find available Pawn moves, for all of \p mover's Pawns at \p pawns at once.
+///        For Pawn promotion scenarios, create multiple moves, one for each Pawn promotion type.
 ///
 /// Note: Some of this code makes variant-specific presumptions about what types of moves
 ///       Pawns can make. This would need to be revised for some future variants.
-/// \todo: Consider refactoring duplicated code into one or more new helper methods.
 template<>
-void Board<Glinski>::findStandardPawnMoves(
-    /* out */ Moves& moves,
-    Index from,
-    Color mover
+void Board<Glinski>::findPawnMoves(
+    /* out */ VariantMoveList& moves,
+    Color mover,
+    const typename Glinski::Bits& pawns,
+    const typename Glinski::Bits& targets
     ) const
 {
-    // ========== Can advance? ==========
-    // ---------- Can advance one space? ----------
-    for (Index adv1Index : V::pawnAdvance1Indices(from, mover)) {
-        if (!isPieceAt(adv1Index)) {
-            if (V::pawnPromotionBits(mover).test(adv1Index)) {
+    using Bits = typename V::Bits;
+
+    const Bits empty = ~anyPieceBits();
+    const Bits& promotionBits = V::pawnPromotionBits(mover);
+    const DirIndex advance = V::pawnAdvanceDirIndex(mover);
+    const DirIndex retreat = BoardDir::reverseDir(advance);
+
+    // Outputs a move for each destination in dests, or one per promotion type on promotionBits.
+    auto addMoves = [&](const Bits& dests, DirIndex backDir, Short stepCount, bool isCapture) {
+        for (Index dest : dests) {
+            Index from = V::neighbor(dest, backDir);
+            if (stepCount == 2) {
+                from = V::neighbor(from, backDir);
+            }
+            OptPieceType optCaptured = isCapture
+                ? std::make_optional(pieceCodePieceType(pieceCodeAt(dest)))
+                : std::nullopt;
+            if (promotionBits.test(dest)) {
                 for (PieceType promotionPieceType : V::promotionPieceTypes) {
-                    Move move{ mover, PieceType::Pawn, from, adv1Index,
-                           MoveEnum::PawnPromotion,
-                           std::nullopt,  // Not a capture
-                           std::make_optional<PieceType>(promotionPieceType),
-                           std::nullopt  // Check type not yet determined
-                         };
-                    moves.push_back(move);
+                    moves.push_back(Move{ mover, PieceType::Pawn, from, dest,
+                                          MoveEnum::PawnPromotion,
+                                          optCaptured,
+                                          std::make_optional<PieceType>(promotionPieceType),
+                                          std::nullopt  // Check type not yet determined
+                                        });
                 }
             } else {
-                Move move{ mover, PieceType::Pawn, from, adv1Index,
-                    MoveEnum::Simple,
-                    std::nullopt,  // Not a capture
-                    std::nullopt,  // Not a Pawn promotion
-                    std::nullopt   // Check type not yet determined
-                };
-                moves.push_back(move);
-            }
-
-            // Having confirmed that the first space is clear, check to see
-            //     whether any Pawn double-step moves are available.
-            // ---------- Can advance two spaces? ----------
-            if (V::pawnStartBits(mover).test(from)) {
-                for (Index adv2Index : V::pawnAdvance2Indices(from, mover)) {
-                    if (!isPieceAt(adv2Index)) {
-                        Move move{ mover, PieceType::Pawn, from, adv2Index,
-                                   MoveEnum::Simple,
-                                   std::nullopt,  // Not capture
-                                   std::nullopt,  // Not Pawn promotion
-                                   std::nullopt   // Unknown Check type
-                                 };
-                        moves.push_back(move);
-                    }
-                }
+                moves.push_back(Move{ mover, PieceType::Pawn, from, dest,
+                                      MoveEnum::Simple,
+                                      optCaptured,
+                                      std::nullopt,  // Not a Pawn promotion
+                                      std::nullopt   // Check type not yet determined
+                                    });
             }
         }
-    }
+    };
+
+    // ========== Can advance? ==========
+    // A double step is only available if the single step's cell is empty.
+    const Bits push1 = V::shift(pawns, advance) & empty;
+    const Bits push2 = V::shift(push1 & V::shift(pawns & V::pawnStartBits(mover), advance), advance)
+                     & empty;
+    addMoves(push1 & targets, retreat, 1, false);
+    addMoves(push2 & targets, retreat, 2, false);
+
     // ========== Can capture? ==========
-    for (Index capIndex : V::pawnCaptureIndices(from, mover)) {
-        Color oppColor = opponent(mover);
-        if (!isPieceAt(capIndex, mover) && isPieceAt(capIndex, oppColor)) {
-            // Capture
-            PieceType oppPt = getPieceTypeAt(capIndex, oppColor);
-            if (V::pawnPromotionBits(mover).test(capIndex)) {  // Pawn promotion?
-                for (PieceType promotionPieceType : V::promotionPieceTypes) {
-                    Move move{ mover, PieceType::Pawn, from, capIndex,
-                               MoveEnum::PawnPromotion,
-                               oppPt, // Capture
-                               std::make_optional<PieceType>(promotionPieceType), // Promotion
-                               std::nullopt  // Unknown check type
-                             };
-                    moves.push_back(move);
-                }
-            } else /* No PawnPromotion */ {
-                Move move{ mover, PieceType::Pawn, from, capIndex,
-                           MoveEnum::Simple,
-                           oppPt,         // Capture
-                           std::nullopt,  // Not a Pawn promotion
-                           std::nullopt   // Unknown Check type
-                         };
-                moves.push_back(move);
+    const Bits captureTargets = anyPieceBits(opponent(mover)) & targets;
+    for (Short k = 0; k < 2; ++k) {
+        const DirIndex d = V::pawnCaptureDirIndex(mover, k);
+        addMoves(V::shift(pawns, d) & captureTargets, BoardDir::reverseDir(d), 1, true);
+    }
+
+    // ========== Can capture en passant? ==========
+    if (mover == _pos.mover && _pos.optEpIndex.has_value()) {
+        const Index epIndex = _pos.optEpIndex.value();
+        if (targets.test(epIndex) || targets.test(V::neighbor(epIndex, retreat))) {
+            // The Pawns that attack the en passant cell are those it would attack as an opposing Pawn.
+            for (Index from : pawns & V::pawnAttacks[colorIndex(opponent(mover))][epIndex]) {
+                moves.push_back(Move{ mover, PieceType::Pawn, from, epIndex,
+                                      MoveEnum::EnPassant,
+                                      PieceType::Pawn,  // Capture
+                                      std::nullopt,     // Not a Pawn promotion
+                                      std::nullopt      // Unknown Check type
+                                    });
             }
         }
     }
 }
 
+/// \brief Find available Pawn moves for the Pawn at \p from. See findPawnMoves.
 template<>
-void Board<Glinski>::findPseudoLegalMoves(/* out */ Moves& moves,
-    Index from, Color mover, PieceType pt, bool isVirtual
+void Board<Glinski>::findStandardPawnMoves(
+    /* out */ VariantMoveList& moves,
+    Index from,
+    Color mover,
+    const typename Glinski::Bits& targets
+    ) const
+{
+    findPawnMoves(moves, mover, Glinski::Bits::fromIndex(from), targets);
+}
+
+template<>
+void Board<Glinski>::findPseudoLegalMoves(/* out */ VariantMoveList& moves,
+    Index from, Color mover, PieceType pt, const typename Glinski::Bits& targets, bool isVirtual
     ) const
 {
     bool debug{false};
@@ -756,22 +855,18 @@ void Board<Glinski>::findPseudoLegalMoves(/* out */ Moves& moves,
     }
     switch (pt) {
     case PieceType::King:
-        findLeapMoves(moves, from, mover, pt, V::kingDests.at(from));
+        findLeapMoves(moves, from, mover, pt, V::kingAttacks[from] & targets);
         break;
     case PieceType::Queen:
-        findSlideMoves(moves, from, mover, pt, V::queenRays.at(from), isVirtual);
-        break;
     case PieceType::Rook:
-        findSlideMoves(moves, from, mover, pt, V::rookRays.at(from), isVirtual);
-        break;
     case PieceType::Bishop:
-        findSlideMoves(moves, from, mover, pt, V::bishopRays.at(from), isVirtual);
+        findLeapMoves(moves, from, mover, pt, SliderAttacks<V>::attacks(pt, from, anyPieceBits()) & targets);
         break;
     case PieceType::Knight:
-        findLeapMoves(moves, from, mover, pt, V::knightDests.at(from));
+        findLeapMoves(moves, from, mover, pt, V::knightAttacks[from] & targets);
         break;
     case PieceType::Pawn:
-        findStandardPawnMoves(moves, from, mover);
+        findStandardPawnMoves(moves, from, mover, targets);
         break;
     default:
         throw std::logic_error("Board::pseudoLegalDestinations: Unrecognized PieceType");
@@ -779,10 +874,13 @@ void Board<Glinski>::findPseudoLegalMoves(/* out */ Moves& moves,
 }
 
 template<>
-void Board<Glinski>::findPseudoLegalMoves(/* out */ Moves& moves, Color mover) const {
-    for (auto [from, c, pt] : piecesDense(mover)) {
-        findPseudoLegalMoves(moves, from, c, pt);
+void Board<Glinski>::findPseudoLegalMoves(/* out */ VariantMoveList& moves,
+    Color mover, const typename Glinski::Bits& targets) const
+{
+    for (Index from : anyPieceBits(mover) & ~pawnBits(mover)) {
+        findPseudoLegalMoves(moves, from, mover, pieceCodePieceType(pieceCodeAt(from)), targets);
     }
+    findPawnMoves(moves, mover, pawnBits(mover), targets);
 }
 
 template<>
@@ -792,7 +890,11 @@ bool Board<Glinski>::_moveSanityCheck(const Move& move) const {
     assert(move.from() != move.to());
     assert(getPieceTypeAt(move.from(), move.mover()) == move.pieceType());
 
-    if (move.isCapture()) {
+    if (move.isEnPassant()) {
+        assert(!isPieceAt(move.to()));
+        assert(isPieceAt(V::neighbor(move.to(), V::pawnAdvanceDirIndex(opponent(move.mover()))),
+                         opponent(move.mover()), PieceType::Pawn));
+    } else if (move.isCapture()) {
         assert(isPieceAt(move.to(), opponent(move.mover())));
     } else {
         assert(!isPieceAt(move.to()));
@@ -809,141 +911,298 @@ void Board<Glinski>::recordPseudoLegalMoves(const Moves& moves) cache_const {
             assert(_moveSanityCheck(move));
         }
     }
-    _cache.optPseudoLegalMoves = std::make_optional<Moves>(moves);
+    _cache.pseudoLegalMoves.assign(moves.begin(), moves.end());
+    _cache.pseudoLegalMovesGeneration = _cache.generation;
 };
 
 template<>
 Moves Board<Glinski>::getPseudoLegalMoves(Color mover) cache_const {
-    if (_cache.optPseudoLegalMoves.has_value()) {
-        return _cache.optPseudoLegalMoves.value();
+    if (_cache.hasPseudoLegalMoves()) {
+        return _cache.pseudoLegalMoves;
     } else {
-        Moves moves{};
+        VariantMoveList moves{};
         findPseudoLegalMoves(moves, mover);
-        recordPseudoLegalMoves(moves);
-        return moves;
+        Moves result = moves.toMoves();
+        recordPseudoLegalMoves(result);
+        return result;
     }
 }
 
 // ========================================
 // Legal moves
 
-/// \brief Returns true iff a player moving a piece from \p from to \p to
-///        would cause put that same player's King in check.
+/// \brief Returns true iff the King of Color \p kColor would be attacked after \p move.
 ///
-/// Tactic: Re-use information about piece move capabilities already cached.
-///
-/// The only types of moves that can put the moving player into (self-)check is
-///   one that removes an obstruction from an opponent's sliding piece.
-/// \todo Support scenario in which e.p. capture exposes King to attack by slider.
+/// The move is not executed. Instead, the occupancy after the move is passed to the
+/// slider attack lookup, so that both discovered attacks and attacks by the moved
+/// piece itself are found. If the King in question is the piece moved, its destination is tested.
 template<>
 bool Board<Glinski>::_isKingAttackedAfterMove(const Move& move, Color kColor) cache_const
 {
-    Scope scope{"Board::_isKingAttackedAfterMove"};
-    // If the King in question has moved, cached info is not helpful
-    assert(move.pieceType() != PieceType::King || move.mover() != kColor);
-
     Index from = move.from();
     Index to = move.to();
     Color mover  = move.mover();
     PieceType moverType  = move.pieceType();
-    Index kIndex = getKingIndex(kColor);
+    Index kIndex = (moverType == PieceType::King && mover == kColor) ? to : getKingIndex(kColor);
     assert(kIndex >= 0 && kIndex < V::CELL_COUNT);
 
-    const HexRayCores obstructed = getObstructedHexRayCores(from);
-    for (const auto& [obsStart, obsDir] : obstructed) {
-        // print(cout, scope(),
-        //     "[obsStart=", obsStart, " obsDir=", obsDir,
-        //     ", move=", move.move_pgn_string(false), "] ",
-        //     "Testing obstructed Ray\n");
-        assert(obsStart != from);  // A piece doesn't obstruct itself.
-        if (getColorAt(obsStart) == opponent(kColor)) {
-            // The piece moved was an obstruction of the opponent's slider
-            HexDir obsToKingDir = (V::indexToPos(kIndex) - V::indexToPos(obsStart));
-            Short collinearTestValue = obsDir.hex0 * obsToKingDir.hex1
-                                     - obsDir.hex1 * obsToKingDir.hex0;
-            if (collinearTestValue == 0) {
-
-                // They're collinear, so this Ray might now attack the King. Re-trace it.
-                for (HexPos cursor = V::indexToPos(obsStart) + obsDir;
-                    V::isOnBoard(cursor);
-                    cursor += obsDir)
-                {
-                    Index curIndex = V::posToIndex(cursor);
-                    if (curIndex == kIndex) {
-                        return true;
-                    }
-                    if (curIndex == to || isPieceAt(curIndex)) {
-                        return false;  // Obstructed
-                    }
-                }
-            }
-        }
+    typename V::Bits occupancy = anyPieceBits();
+    occupancy.reset(from);
+    occupancy.set(to);
+    typename V::Bits captured = V::Bits::fromIndex(to);
+    if (move.moveEnum() == MoveEnum::EnPassant) {
+        Index epCaptureIndex = V::neighbor(to, V::pawnAdvanceDirIndex(opponent(mover)));
+        occupancy.reset(epCaptureIndex);
+        captured.set(epCaptureIndex);
     }
+
     if (mover == kColor) {
-        // Moving piece is the same color as the King, so it cannot attack
-        return false;
+        // Only the opponent's pieces can attack, except for any just captured
+        return (attackersTo(kIndex, opponent(kColor), occupancy) & ~captured).any();
+    }
+
+    // Discovered attacks, by pieces other than the one moved
+    if (attackersTo(kIndex, mover, occupancy).reset(from).any()) {
+        return true;
     }
 
     // Does moving piece attack King from new position?
     if (moverType == PieceType::Pawn) {
-        if (V::pawnCaptureBits(to, mover).test(kIndex)) {
+        if (V::pawnAttacks[colorIndex(mover)][to].test(kIndex)) {
             return true;
         } else if (!V::pawnPromotionBits(mover).test(to)) {
             return false;
         }
         moverType = move.optPromotedTo().value();
     }
-    if (isLeaper(moverType)) {
-        switch(moverType) {
-        case PieceType::King:
-            // TODO: Convert kingDests to use std::set?
-            for (Index dest : V::kingDests.at(to)) {
-                if (dest == kIndex) {
-                    return true;  // Note: Shouldn't happen
-                }
+    switch(moverType) {
+    case PieceType::King:
+        return V::kingAttacks[to].test(kIndex);  // Note: Shouldn't happen
+    case PieceType::Knight:
+        return V::knightAttacks[to].test(kIndex);
+    case PieceType::Queen:
+    case PieceType::Rook:
+    case PieceType::Bishop:
+        return SliderAttacks<V>::attacks(moverType, to, occupancy).test(kIndex);
+    default:
+        throw std::logic_error{"Board::_isKingAttackedAfterMove: Unrecognized piece type"};
+    }
+}
+
+template<>
+typename Glinski::Bits Board<Glinski>::_findPinned(
+    /* out */ std::array<typename Glinski::Bits, SliderAttacks<Glinski>::LINE_COUNT>& pinnedOnLine,
+    Color c) const
+{
+    using SA = SliderAttacks<V>;
+    using Bits = typename V::Bits;
+
+    const Color opp = opponent(c);
+    const Index kIndex = getKingIndex(c);
+    const Bits oppQueens = queenBits(opp);
+    Bits result{};
+    for (Short line = 0; line < SA::LINE_COUNT; ++line) {
+        Bits snipers = oppQueens
+                     | (line < SA::ORTHO_LINE_COUNT ? rookBits(opp) : bishopBits(opp));
+        // The nearest sniper in each direction along the line, looking through other pieces
+        for (Index sniper : SA::lineAttacks(kIndex, line, snipers) & snipers) {
+            Bits blockers = V::betweenBits[kIndex][sniper] & anyPieceBits();
+            if (blockers.count() == 1 && (blockers & anyPieceBits(c)).any()) {
+                pinnedOnLine[line] |= blockers;
+                result |= blockers;
             }
-            return false;
+        }
+    }
+    return result;
+}
+
+template<>
+void Board<Glinski>::findEvasionMoves(/* out */ VariantMoveList& moves,
+    Color c, const typename Glinski::Bits& checkers, const typename Glinski::Bits& moveTargets) const
+{
+    using SA = SliderAttacks<V>;
+    using Bits = typename V::Bits;
+
+    const Color opp = opponent(c);
+    const Index kIndex = getKingIndex(c);
+    const Bits& occupancy = anyPieceBits();
+    assert(checkers.any());
+
+    // ---------- King moves: To cells not attacked once the King has left its cell ----------
+    Bits occupancyWithoutKing = occupancy;
+    occupancyWithoutKing.reset(kIndex);
+    Bits kingTargets{};
+    // Cells attacked by Pawns are excluded at once; other attackers are looked for cell by cell.
+    for (Index dest : V::kingAttacks[kIndex] & moveTargets & ~anyPieceBits(c) & ~pawnAttackBits(opp)) {
+        if (attackersTo(dest, opp, occupancyWithoutKing).none()) {
+            kingTargets.set(dest);
+        }
+    }
+    findLeapMoves(moves, kIndex, c, PieceType::King, kingTargets);
+    if (checkers.count() > 1) {
+        return;  // Double check: Only the King can move
+    }
+
+    // ---------- Capture the checker, or block its line to the King ----------
+    Index checker = checkers.lsb();
+    Bits targets = Bits::fromIndex(checker);
+    if (isSlider(pieceCodePieceType(pieceCodeAt(checker)))) {
+        targets |= V::betweenBits[kIndex][checker];
+    }
+    targets &= moveTargets;
+    // A pinned piece cannot leave its line through the King, which does not meet targets.
+    std::array<Bits, SA::LINE_COUNT> pinnedOnLine{};
+    Bits movers = anyPieceBits(c) & ~_findPinned(pinnedOnLine, c);
+    movers.reset(kIndex);
+    for (Index from : movers & ~pawnBits(c)) {
+        PieceType pt = pieceCodePieceType(pieceCodeAt(from));
+        switch (pt) {
+        case PieceType::Queen:
+        case PieceType::Rook:
+        case PieceType::Bishop:
+            findLeapMoves(moves, from, c, pt, SA::attacks(pt, from, occupancy) & targets);
+            break;
         case PieceType::Knight:
-            // TODO: Convert kingDests to use std::set?
-            for (Index dest : V::kingDests.at(to)) {
-                if (dest == kIndex) {
-                    return true;  // Note: Shouldn't happen
-                }
-            }
-            return false;
+            findLeapMoves(moves, from, c, pt, V::knightAttacks[from] & targets);
+            break;
         default:
-            throw std::logic_error{"Board::_isKingAttackedAfterMove: Unrecognized piece type"};
+            throw std::logic_error{"Board::findEvasionMoves: Unrecognized PieceType"};
         }
     }
-    assert(isSlider(moverType));
-    Moves pseudoLegalMoves{};
-    /// \todo Test individual rays instead of calling findPseudoLegalMoves
-    /// Note: No need to check legality for checks
-    findPseudoLegalMoves(pseudoLegalMoves, to, mover, moverType, true);
-    for (const Move& move : pseudoLegalMoves) {
-        if (move.to() == kIndex) {
-            return true;
+
+    const Size pawnMovesBegin = moves.size();
+    findPawnMoves(moves, c, movers & pawnBits(c), targets);
+    // En passant captures, which are output last, can expose the King along the row.
+    Size epBegin = moves.size();
+    while (epBegin > pawnMovesBegin && moves[epBegin - 1].isEnPassant()) {
+        --epBegin;
+    }
+    Size legalEnd = epBegin;
+    for (Size k = epBegin; k < moves.size(); ++k) {
+        if (!_isKingAttackedAfterMove(moves[k], c)) {
+            moves[legalEnd++] = moves[k];
         }
     }
-    return false;
+    while (moves.size() > legalEnd) {
+        moves.pop_back();
+    }
+}
+
+template<>
+void Board<Glinski>::findLegalMoves(/* out */ VariantMoveList& moves,
+    Color c, const typename Glinski::Bits& targets) const
+{
+    using SA = SliderAttacks<V>;
+    using Bits = typename V::Bits;
+
+    const Index kIndex = getKingIndex(c);
+    const Bits checkers = attackersTo(kIndex, opponent(c));
+    if (checkers.any()) {
+        findEvasionMoves(moves, c, checkers, targets);
+        return;
+    }
+
+    std::array<Bits, SA::LINE_COUNT> pinnedOnLine{};
+    const Bits pinned = _findPinned(pinnedOnLine, c);
+
+    VariantMoveList pseudoLegalMoves{};
+    findPseudoLegalMoves(pseudoLegalMoves, c, targets);
+    for (const Move& candMove : pseudoLegalMoves) {
+        if (candMove.pieceType() == PieceType::King || candMove.isEnPassant()) {
+            if (!_isKingAttackedAfterMove(candMove, c)) {
+                moves.push_back(candMove);
+            }
+            continue;
+        }
+        if (pinned.test(candMove.from())) {
+            // A pinned piece can only move along the line through its King.
+            Short line = 0;
+            while (!pinnedOnLine[line].test(candMove.from())) {
+                ++line;
+            }
+            if (!SA::lineAttacks(kIndex, line, Bits{}).test(candMove.to())) {
+                continue;
+            }
+        }
+        moves.push_back(candMove);
+    }
+}
+
+template<>
+bool Board<Glinski>::isLegalMove(const Move& move) const {
+    const Color c = move.mover();
+    const Short ci = colorIndex(c);
+    const Index from = move.from();
+    const Index to = move.to();
+    const PieceType pt = move.pieceType();
+    if (c != _pos.mover || pieceCodeAt(from) != pieceCode(c, pt) || anyPieceBits(c).test(to)) {
+        return false;
+    }
+    if (move.isEnPassant()) {
+        if (pt != PieceType::Pawn || _pos.optEpIndex != std::make_optional(to)
+            || !V::pawnAttacks[ci][from].test(to))
+        {
+            return false;
+        }
+    } else {
+        PieceCode destCode = pieceCodeAt(to);
+        if (move.optCaptured() != (destCode != noPieceCode
+                                       ? std::make_optional(pieceCodePieceType(destCode))
+                                       : std::nullopt))
+        {
+            return false;
+        }
+        if (pt == PieceType::Pawn) {
+            if (move.isPromotion() != V::pawnPromotionBits(c).test(to)) {
+                return false;
+            }
+            if (move.isCapture()) {
+                if (!V::pawnAttacks[ci][from].test(to)) {
+                    return false;
+                }
+            } else if (!V::pawnPush1[ci][from].test(to)) {
+                // A double step must pass over an empty cell
+                if (!V::pawnPush2[ci][from].test(to)
+                    || anyPieceBits().test(V::neighbor(from, V::pawnAdvanceDirIndex(c))))
+                {
+                    return false;
+                }
+            }
+        } else {
+            if (move.isPromotion() || move.isCastling()) {
+                return false;
+            }
+            switch (pt) {
+            case PieceType::King:
+                if (!V::kingAttacks[from].test(to)) { return false; }
+                break;
+            case PieceType::Knight:
+                if (!V::knightAttacks[from].test(to)) { return false; }
+                break;
+            default:
+                if (!SliderAttacks<V>::attacks(pt, from, anyPieceBits()).test(to)) { return false; }
+                break;
+            }
+        }
+    }
+    return !_isKingAttackedAfterMove(move, c);
 }
 
 template<>
 void Board<Glinski>::recordMoveCheckEnum(const Move& move, CheckEnum ce) cache_const {
-    MHash hash = move.getHash();
-    _cache.mhashToCheckEnum[hash] = ce;
+    _cache.moveCheckEnums.insert(move.getHash(), ce, _cache.generation);
 }
 
 template<>
 CheckEnum Board<Glinski>::getMoveCheckEnum(const Move& move) cache_const {
-    MHash hash = move.getHash();
-    if (_cache.mhashToCheckEnum.contains(hash)) {
-        return _cache.mhashToCheckEnum.at(hash);
+    const MHash hash = move.getHash();
+    if (OptCheckEnum optCe = _cache.moveCheckEnums.find(hash, _cache.generation)) {
+        return optCe.value();
     }
     CheckEnum result = _isKingAttackedAfterMove(move, opponent(move.mover()))
                             ? CheckEnum::Check
                             : CheckEnum::None;
-    _cache.mhashToCheckEnum[hash] = result;
+    _cache.moveCheckEnums.insert(hash, result, _cache.generation);
     return result;
 }
 
@@ -956,21 +1215,21 @@ void Board<Glinski>::recordLegalMoves(const Moves& moves) cache_const {
             assert(_moveSanityCheck(move));
         }
     }
-    _cache.optLegalMoves = std::make_optional<Moves>(moves);
+    _cache.legalMoves.assign(moves.begin(), moves.end());
+    _cache.legalMovesGeneration = _cache.generation;
 };
 
 // TODO: Also handle Checkmate
 template<>
 const Moves Board<Glinski>::getLegalMoves(Color c) const {
     assert(c == mover());
-    if (_cache.optLegalMoves.has_value()) {
-        return _cache.optLegalMoves.value();
+    if (_cache.hasLegalMoves()) {
+        return _cache.legalMoves;
     } else {
-        Moves pseudoLegalMoves = getPseudoLegalMoves(c);
-        Moves result{};
-        findLegalMoves(result, c, pseudoLegalMoves);
+        VariantMoveList moves{};
+        findLegalMoves(moves, c);
+        Moves result = moves.toMoves();
         recordLegalMoves(result);
-        Short legalMoveCount = result.size();
         return result;
     }
 }
@@ -995,8 +1254,16 @@ CheckEnum Board<Glinski>::setLegalMoveCheckEnums(Color mover) cache_const {
 // Attacks
 
 template<>
-bool Board<Glinski>::isAttacking(Index from, Color, PieceType pt, Index tgt) const {
-    throw NotImplementedException{"Board<>::isAttacking"};
+bool Board<Glinski>::isAttacking(Index from, Color c, PieceType pt, Index tgt) const {
+    return pieceAttacks(from, c, pt).test(tgt);
+}
+
+template<>
+Short Board<Glinski>::attackerCount(Index index, Color c) const {
+    if (_optAttackMaps.has_value()) {
+        return _optAttackMaps.value().attackerCount(index, c);
+    }
+    return attackersTo(index, c).count();
 }
 
 template<>
@@ -1022,8 +1289,10 @@ CheckEnum Board<Glinski>::getCheckEnum() cache_const {
         }
     }
     if (isOwnCellAttacked(getKingIndex(mover()))) {
-        recordCheckEnum(CheckEnum::Check);
-        return CheckEnum::Check;
+        // In check with no legal moves (found with the evasion generator) is Checkmate.
+        CheckEnum result = getLegalMoves(mover()).empty() ? CheckEnum::Checkmate : CheckEnum::Check;
+        recordCheckEnum(result);
+        return result;
     }
     recordCheckEnum(CheckEnum::None);
     return CheckEnum::None;
@@ -1088,15 +1357,13 @@ GameOutcome Board<Glinski>::getOutcome() cache_const {
     }
 
     // ---------- Draw by 3x Board repetition ----------
-    if (_currentCounter > 2) {
-        if (_zHashToCounters.at(_zHashes.at(_currentCounter - 1)).size() == 3) {
-            GameOutcome outcome{Termination::Draw_3xBoardRepetition};
-            recordOutcome(outcome);
-            return outcome;
-        }
+    if (isRepetition(2)) {
+        GameOutcome outcome{Termination::Draw_3xBoardRepetition};
+        recordOutcome(outcome);
+        return outcome;
     }
     // ---------- Draw by 50 Move rule ----------
-    if (_nonProgressCounter >= 50) {
+    if (_pos.nonProgressCounter >= 50) {
         GameOutcome outcome{Termination::Draw_50MoveRule};
         recordOutcome(outcome);
         return outcome;
@@ -1159,47 +1426,10 @@ void Board<Glinski>::moveExec(const Move& move) {
                && move.isCapture()
               )
           );
-    if (move.optCaptured().has_value()) {
-        Index capInd = move.isEnPassant()
-                     ? _optEpIndex.value()
-                     : move.to();
-        Color c = opponent(move.mover());
-        PieceType pt = move.optCaptured().value();
-        _bitsReset(capInd, c, pt);
-    }
-    _bitsConsistencyTest();
-
-    // ========== Move ==========
-    _bitsMove(_anyPieceBits, move.from(), move.to());
-    _bitsMove(_colorToAnyPieceBits, move.mover(), move.from(), move.to());
+    // ========== Update hash history ==========
+    _zHashes.push_back(_pos.zHash);  // The position being left, for repetition detection
 
-    switch (move.pieceType()) {
-    case PieceType::King:
-        _bitsMove(_colorToKingBits, move.mover(), move.from(), move.to());
-        setKingIndex(move.to(), move.mover());
-        break;
-    case PieceType::Queen:
-        _bitsMove(_colorToQueenBits, move.mover(), move.from(), move.to());
-        break;
-    case PieceType::Rook:
-        _bitsMove(_colorToRookBits, move.mover(), move.from(), move.to());
-        break;
-    case PieceType::Bishop:
-        _bitsMove(_colorToBishopBits, move.mover(), move.from(), move.to());
-        break;
-    case PieceType::Knight:
-        _bitsMove(_colorToKnightBits, move.mover(), move.from(), move.to());
-        break;
-    case PieceType::Pawn:
-        _bitsMove(_colorToPawnBits, move.mover(), move.from(), move.to());
-        if (move.optPromotedTo().has_value()) {
-            changePieceType(move.to(), move.mover(), PieceType::Pawn,
-                move.optPromotedTo().value());
-        }
-        break;
-    default:
-        throw std::logic_error("Board::moveMake: Unrecognized PieceType");
-    }
+    _makeMovePieces(move);
     _bitsConsistencyTest();
 
     // ---------- Castling ----------
@@ -1211,7 +1441,7 @@ void Board<Glinski>::moveExec(const Move& move) {
 
     // ---------- Set en passant cell ----------
     if (move.pieceType() == PieceType::Pawn
-       && abs(V::row(move.to() - move.from())) == 4)  // 4 half-rows = 2 rows
+       && abs(V::row(move.to()) - V::row(move.from())) == 4)  // 4 half-rows = 2 rows
     {
         // One step forward from Pawn's starting position.
         // Note: Taking the 1st of the advance positions is variant-specific.
@@ -1219,42 +1449,32 @@ void Board<Glinski>::moveExec(const Move& move) {
             print(cout, scope(), "Board=", name(), "[3], counter=", currentCounter(),
                 ". Setting e.p. index\n");
         }
-        Index epInd = V::colorToPawnAdvance1Indices
-                          .at(move.mover()).at(move.from())[0];
-        _optEpIndex = std::make_optional(epInd);
+        Index epInd = V::neighbor(move.from(), V::pawnAdvanceDirIndex(move.mover()));
+        _setOptEpIndex(std::make_optional(epInd));
     } else {
-        _optEpIndex = std::nullopt;
+        _setOptEpIndex(std::nullopt);
     }
 
     // ========== Update progress counter ==========
+    _nonProgressCounters.push_back(_pos.nonProgressCounter);  // Restored by moveUndo
     if (move.isProgressMove()) {
-        _nonProgressCounter = 0;
+        _pos.nonProgressCounter = 0;
     } else {
-        _nonProgressCounter++;
+        _pos.nonProgressCounter++;
     }
-    _nonProgressCounters.push_back(_currentCounter);
-
-    // ========== Update hash history ==========
-    ZHash hash = zobristHash();
-    if (_zHashToCounters.contains(hash)) {
-        _zHashToCounters[hash] = Shorts{1, _currentCounter};
-    } else {
-        _zHashToCounters[hash].push_back(_currentCounter);
-        if (_zHashToCounters[hash].size() == 3) {
-           _cache.optOutcome = std::make_optional<GameOutcome>(
-                                   Termination::Draw_3xBoardRepetition);
-        }
+    _setMover(nextPlayer(move.mover()));
+    if (debug) {
+        _zobristConsistencyTest();
+        _attackMapsConsistencyTest();
     }
-    _zHashes.push_back(hash);
 
     // ========== Update move stack ==========
     _moveStack.push_back(move);
 
     // ========== Next move and isGameOver check ==========
-    _cache.clear(_currentCounter);
-    _currentCounter++;
-    _mover = nextPlayer(move.mover());
-    // (void) getLegalMoves(_mover);
+    _cache.clear(_pos.currentCounter);
+    _pos.currentCounter++;
+    // (void) getLegalMoves(_pos.mover);
     // (void) getOptOutcome();
 
     // if (getIsGameOver()) {
@@ -1268,7 +1488,7 @@ void Board<Glinski>::moveExec(const Move& move) {
         print(cout, scope(), "Board=", name(), "[4], counter=", currentCounter(),
             ". ========== ",
             " Mover ", color_long_string(move.mover()),
-            " completed move #", _currentCounter + 1, ": ", move.move_pgn_string(false),
+            " completed move #", _pos.currentCounter + 1, ": ", move.move_pgn_string(false),
             " ==========\n");
     }
 }
@@ -1302,9 +1522,7 @@ void Board<Glinski>::moveUndo(const Move& move) {
         ", move to undo=", move.move_pgn_string(false),
         ", Undoing en passant move\n");
         Color opp = opponent(move.mover());
-        HexDir oppFwd{V::pawnAdvanceDirs(opp)[0]};
-        HexPos captPos{V::indexToPos(move.to()) + oppFwd};
-        Index captInd = V::posToIndex(captPos);
+        Index captInd = V::neighbor(move.to(), V::pawnAdvanceDirIndex(opp));
         addPiece(captInd, opp, PieceType::Pawn);
         break;
     }
@@ -1332,8 +1550,8 @@ void Board<Glinski>::moveUndo(const Move& move) {
     // Move piece back to original location
     movePiece(move.to(), move.from(), move.mover(), move.pieceType());
 
-    // Replace captured piece, if any
-    if (move.isCapture()) {
+    // Replace captured piece, if any (an en passant capture was replaced above)
+    if (move.isCapture() && !move.isEnPassant()) {
         print(cout, scope(), "Counter=", currentCounter(),
             ", moveStack.size()=", _moveStack.size(),
             ", move to undo=", move.move_pgn_string(false),
@@ -1348,18 +1566,17 @@ void Board<Glinski>::moveUndo(const Move& move) {
         ", moveStack.size()=", _moveStack.size(),
         ", move to undo=", move.move_pgn_string(false),
         ", PawnPromotion. Undoing Zobrist hash history.\n");
-    ZHash lastHash = _zHashes.at(_zHashes.size() - 1);
-    _zHashes.pop_back();  // Remove from per-ply vector of board hashes
-    _zHashToCounters[lastHash].pop_back();  // Remove last occurrence of this hash
+    _zHashes.pop_back();  // Remove the hash of the position being returned to
 
     // Undo nonProgressCounters
     print(cout, scope(), "Counter=", currentCounter(),
         ", moveStack.size()=", _moveStack.size(),
         ", move to undo=", move.move_pgn_string(false),
         ", PawnPromotion. Undoing non-progress counters.\n");
+    _pos.nonProgressCounter = _nonProgressCounters.at(_nonProgressCounters.size() - 1);
     _nonProgressCounters.pop_back();
 
-    // _optEpIndex
+    // _pos.optEpIndex
     print(cout, scope(), "Counter=", currentCounter(),
         ", moveStack.size()=", _moveStack.size(),
         ", move to undo=", move.move_pgn_string(false),
@@ -1368,26 +1585,94 @@ void Board<Glinski>::moveUndo(const Move& move) {
         print(cout, scope(), "Counter=", currentCounter(),
             ", moveStack[", k, "]=", _moveStack.at(k).move_pgn_string(false), "\n");
     }
-    const Move& prevMove = _moveStack.at(_currentCounter - 1);
-    if (abs(V::row(prevMove.to()) - V::row(prevMove.from())) == 4) {
-        _optEpIndex = V::average(prevMove.to(), prevMove.from());
-    } else {
-        _optEpIndex = std::nullopt;
+    // The en passant cell (if any) was set by the move preceding the one being undone.
+    OptIndex optPrevEpIndex{std::nullopt};
+    if (_moveStack.size() >= 2) {
+        const Move& prevMove = _moveStack.at(_moveStack.size() - 2);
+        if (prevMove.pieceType() == PieceType::Pawn
+            && abs(V::row(prevMove.to()) - V::row(prevMove.from())) == 4)
+        {
+            optPrevEpIndex = V::average(prevMove.to(), prevMove.from());
+        }
     }
+    _setOptEpIndex(optPrevEpIndex);
 
     print(cout, scope(), "Counter=", currentCounter(),
         ", moveStack.size()=", _moveStack.size(),
         ", move to undo=", move.move_pgn_string(false),
         ", PawnPromotion. Undoing mover and moveStack.\n");
-    _mover = prevPlayer(move.mover());
+    _setMover(move.mover());
     _moveStack.pop_back();
 
     // Undo HalfMoveCounter and mover Color
-    _currentCounter--;
+    _pos.currentCounter--;
+
+    bool debug{false};  // The checks recompute the hash and attack maps from scratch
+    if (debug) {
+        _zobristConsistencyTest();
+        _attackMapsConsistencyTest();
+    }
 
     // Update cache
-    _cache.clear(_currentCounter);
-    // (void) getLegalMoves(_mover);
+    _cache.clear(_pos.currentCounter);
+    // (void) getLegalMoves(_pos.mover);
+}
+
+template<>
+void Board<Glinski>::makeMove(const Move& move) {
+    _zHashes.push_back(_pos.zHash);
+    _makeMovePieces(move);
+    if (move.pieceType() == PieceType::Pawn
+        && abs(V::row(move.to()) - V::row(move.from())) == 4)  // 4 half-rows = 2 rows
+    {
+        _setOptEpIndex(V::neighbor(move.from(), V::pawnAdvanceDirIndex(move.mover())));
+    } else {
+        _setOptEpIndex(std::nullopt);
+    }
+    _pos.nonProgressCounter = move.isProgressMove() ? 0 : _pos.nonProgressCounter + 1;
+    _setMover(nextPlayer(move.mover()));
+
+    _cache.clear(_pos.currentCounter);
+    _pos.currentCounter++;
+}
+
+template<>
+void Board<Glinski>::makeMove(const Move& move, UndoInfo& undo) {
+    undo.optEpIndex = _pos.optEpIndex;
+    undo.nonProgressCounter = _pos.nonProgressCounter;
+    undo.zHash = _pos.zHash;
+    makeMove(move);
+}
+
+template<>
+void Board<Glinski>::unmakeMove(const Move& move, const UndoInfo& undo) {
+    _pos.currentCounter--;
+    _zHashes.pop_back();
+    _unmakeMovePieces(move);
+
+    // The hash is restored wholesale, so the mover and en passant cell are set directly.
+    _pos.mover = move.mover();
+    _pos.optEpIndex = undo.optEpIndex;
+    _pos.nonProgressCounter = undo.nonProgressCounter;
+    _pos.zHash = undo.zHash;
+    bool debug{false};  // The check recomputes the hash, which would dominate search and perft
+    if (debug) {
+        _zobristConsistencyTest();
+    }
+
+    _cache.clear(_pos.currentCounter);
+}
+
+template<>
+void Board<Glinski>::setPosition(const Position<V>& pos) {
+    // Drop the hashes of the positions being backed out of.
+    const Size plies = static_cast<Size>(_pos.currentCounter - pos.currentCounter);
+    _zHashes.resize(plies <= _zHashes.size() ? _zHashes.size() - plies : 0);
+    _pos = pos;
+    if (_optAttackMaps.has_value()) {
+        _optAttackMaps = attackMapsRecompute();
+    }
+    _cache.clear(_pos.currentCounter);
 }
 
 // ========================================
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cassert>
+#include <cstdint>
 
 #include <array>
 #include <functional>
@@ -29,10 +30,14 @@
 #include <utility>
 #include <vector>
 
+#include "attack_maps.h"
 #include "fen.h"
 #include "game_outcome.h"
 #include "geometry.h"
 #include "move.h"
+#include "move_list.h"
+#include "position.h"
+#include "slider_attacks.h"
 #include "util.h"
 #include "util_hexchess.h"
 #include "variant.h"
@@ -57,6 +62,9 @@ public:
     /// \brief typedef to make the Variant concisely available within the class.
     typedef Variant V;
 
+    /// \brief Inline Move storage with room for the moves of any position of the Variant.
+    using VariantMoveList = MoveList<V::MAX_MOVE_COUNT>;
+
     // ========================================
     // Constructor support
 
@@ -78,6 +86,7 @@ public:
     Board(const std::string& name, bool doPopulate=true);
     Board(const std::string& name, const Fen<V>& fen);
     Board(const std::string& name, const std::string& fenStr);
+    Board(const std::string& name, const Position<V>& pos);
     Board(const std::string& name, const Board& other);
     ~Board() {}
     Board& operator=(const Board& other) = default;  // TODO: Implement
@@ -90,147 +99,148 @@ public:
     void reset(bool doPopulate);
 
     Board<V> shallowCopyMove(const std::string& name, const Move& move) const {
-        Fen fenTmp = fen();
-        fenTmp.currentCounter = (move.mover() == Color::Black ? 1 : 0);
-        Board b{name, fenTmp};
-        if (move.mover() == Color::Black) {  // Add dummy data for the previous move
-            b._zHashToCounters[0] = Shorts{1, b.currentCounter()};
-            b._zHashes.push_back(0);
-        }
-        return b;
+        Position<V> pos = position();
+        pos.currentCounter = (move.mover() == Color::Black ? 1 : 0);
+        return Board{name, pos};
     }
 
+    // ========================================
+    // Position snapshot
+
+    /// \brief Returns the current Position: a trivially copyable snapshot without game history.
+    const Position<V>& position() const { return _pos; }
+
+    /// \brief Restores a Position saved by position(), e.g., after makeMove in copy-make search.
+    ///        \p pos must be the current Position or an earlier one on the current line of play:
+    ///        the hash history is truncated to match, and the rest of the game history is unchanged.
+    void setPosition(const Position<V>& pos);
+
     // ========================================
     // Non-piece data
 
     HalfMoveCounter currentCounter() const;
-    Color mover() const { return _mover; }
+    Color mover() const { return _pos.mover; }
+
+    /// \brief The cell a Pawn skipped over with a double step on the previous move, if any.
+    OptIndex optEpIndex() const { return _pos.optEpIndex; }
 
     // ========================================
     // Write piece data
 
-    void setKingIndex(Index index, Color c) { _colorToKingIndex[c] = index; }
+    void setKingIndex(Index index, Color c) { _pos.kingIndex[colorIndex(c)] = index; }
 
     // ========================================
-    // Piece movement capatibilities (stored as Bits and Indices)
-
-    /// \brief Returns a lookup for Player \p c: Which cells allow a Pawn to advance one cell forward.
-    Indices pawnAdvance1Indices(Index from, Color c) const {
-        return V::_colorToPawnAdvance1Indices.at(c).at(from);
-    }
-
-    /// \brief Returns a lookup for Player \p c: Which cells allow a Pawn to advance two cells forward.
-    Indices pawnAdvance2Indices(Index from, Color c) const {
-        return V::_colorToPawnAdvance2Indices.at(c).at(from);
-    }
-
-    /// \brief Returns a lookup for Player \p c: Which cells allow a Pawn to advance two cells forward.
-    // Indices pawnCaptureBits(Index from, Color c) const {
-    //     return V::_colorToPawnCaptureBits.at(c).at(from);
-    // }
+    // Piece movement capatibilities
+    // (See the Variant's kingAttacks, knightAttacks, pawnAttacks, pawnPush1, and pawnPush2.)
 
     // ========================================
     // Read piece data
 
     /// \brief Returns a Board reflecting which board locations have any piece present.
-    const typename V::Bits anyPieceBits() const {
-        return _anyPieceBits;
+    const typename V::Bits& anyPieceBits() const {
+        return _pos.anyPieceBits;
     }
 
     /// \brief Returns a Board reflecting which board locations have any piece of the specified color.
-    const typename V::Bits anyPieceBits(const Color c) const {
-        return _colorToAnyPieceBits.at(c);
+    const typename V::Bits& anyPieceBits(const Color c) const {
+        return _pos.colorBits[colorIndex(c)];
     }
 
-    /// \brief Returns a Board reflecting which board location(s) have a King of the specified color.
-    const typename V::Bits kingBits(const Color c) const {
-        return _colorToKingBits.at(c);
+    /// \brief Returns a Board reflecting which board location(s) have a piece of the specified color and type.
+    const typename V::Bits& pieceBits(const Color c, const PieceType pt) const {
+        return _pos.pieceBits[colorIndex(c)][pieceTypeIndex(pt)];
     }
 
+    /// \brief Returns a Board reflecting which board location(s) have a King of the specified color.
+    const typename V::Bits& kingBits(const Color c)   const { return pieceBits(c, PieceType::King);   }
+
     /// \brief Returns a Board reflecting which board location(s) have a Queen of the specified color.
-    const typename V::Bits queenBits(const Color c) const {
-        return _colorToQueenBits.at(c);
-    }
+    const typename V::Bits& queenBits(const Color c)  const { return pieceBits(c, PieceType::Queen);  }
 
     /// \brief Returns a Board reflecting which board location(s) have a Rook of the specified color.
-    const typename V::Bits rookBits(const Color c) const {
-        return _colorToRookBits.at(c);
-    }
+    const typename V::Bits& rookBits(const Color c)   const { return pieceBits(c, PieceType::Rook);   }
 
     /// \brief Returns a Board reflecting which board location(s) have a Bishop of the specified color.
-    const typename V::Bits bishopBits(const Color c) const {
-        return _colorToBishopBits.at(c);
-    }
+    const typename V::Bits& bishopBits(const Color c) const { return pieceBits(c, PieceType::Bishop); }
 
     /// \brief Returns a Board reflecting which board location(s) have a Knight of the specified color.
-    const typename V::Bits knightBits(const Color c) const {
-        return _colorToKnightBits.at(c);
-    }
+    const typename V::Bits& knightBits(const Color c) const { return pieceBits(c, PieceType::Knight); }
 
     /// \brief Returns a Board reflecting which board location(s) have a Pawn of the specified color.
-    const typename V::Bits pawnBits(const Color c) const {
-        return _colorToPawnBits.at(c);
-    }
+    const typename V::Bits& pawnBits(const Color c)   const { return pieceBits(c, PieceType::Pawn);   }
+
+    /// \brief Returns the cells attacked by the Pawns of Color \p c.
+    typename V::Bits pawnAttackBits(const Color c) const { return V::pawnAttackBits(c, pawnBits(c)); }
 
     // ========================================
     // Piece index queries
 
     /// \brief Returns a boolean reflecting which board location(s) have a Pawn of the specified color.
     bool isPieceAt(const Index index) const {
-        return _anyPieceBits.test(index);
+        return _pos.anyPieceBits.test(index);
     }
 
     /// \brief Returns a boolean reflecting whether a piece with Color \p c is present at Index \p index.
     bool isPieceAt(const Index index, const Color c)  const {
-        return _colorToAnyPieceBits.at(c).test(index);
+        return anyPieceBits(c).test(index);
+    }
+
+    /// \brief Returns a boolean reflecting whether a piece with Color \p c and PieceType \p pt
+    ///        is present at Index \p index.
+    bool isPieceAt(const Index index, const Color c, const PieceType pt) const {
+        return pieceBits(c, pt).test(index);
     }
 
     /// \brief Returns a boolean reflecting whether a King with Color \p c is present at Index \p index.
-    bool isKingAt(const Index index, const Color c)   const { return _colorToKingBits.at(c).test(index);   }
+    bool isKingAt(const Index index, const Color c)   const { return kingBits(c).test(index);   }
 
     /// \brief Returns a boolean reflecting whether a Queen with Color \p c is present at Index \p index.
-    bool isQueenAt(const Index index, const Color c) const { return _colorToQueenBits.at(c).test(index);   }
+    bool isQueenAt(const Index index, const Color c)  const { return queenBits(c).test(index);  }
 
     /// \brief Returns a boolean reflecting whether a Rook with Color \p c is present at Index \p index.
-    bool isRookAt(const Index index, const Color c)   const { return _colorToRookBits.at(c).test(index);   }
+    bool isRookAt(const Index index, const Color c)   const { return rookBits(c).test(index);   }
 
     /// \brief Returns a boolean reflecting whether a Bishop with Color \p c is present at Index \p index.
-    bool isBishopAt(const Index index, const Color c) const { return _colorToBishopBits.at(c).test(index); }
+    bool isBishopAt(const Index index, const Color c) const { return bishopBits(c).test(index); }
 
     /// \brief Returns a boolean reflecting whether a Knight with Color \p c is present at Index \p index.
-    bool isKnightAt(const Index index, const Color c) const { return _colorToKnightBits.at(c).test(index); }
+    bool isKnightAt(const Index index, const Color c) const { return knightBits(c).test(index); }
 
     /// \brief Returns a boolean reflecting whether a Pawn with Color \p c is present at Index \p index.
-    bool isPawnAt(const Index index, const Color c)   const { return _colorToPawnBits.at(c).test(index);   }
+    bool isPawnAt(const Index index, const Color c)   const { return pawnBits(c).test(index);   }
+
+    Index getKingIndex(Color c) const { return _pos.kingIndex[colorIndex(c)]; }
 
-    Index getKingIndex(Color c) const { return _colorToKingIndex.at(c); }
+    /// \brief Returns the packed Color and PieceType of the piece at Index \p index,
+    ///        or noPieceCode if the cell is empty.
+    PieceCode pieceCodeAt(const Index index) const { return _pos.mailbox[index]; }
 
     // ========================================
     // Piece counts
 
     /// \brief Returns the number of pieces on the board.
-    Short pieceCount()           const { return _anyPieceBits.count(); }
+    Short pieceCount()           const { return _pos.anyPieceBits.count(); }
 
     /// \brief Returns the number of pieces on the board with Color \p c.
-    Short pieceCount(Color c)    const { return _colorToAnyPieceBits.at(c).count(); }
+    Short pieceCount(Color c)    const { return anyPieceBits(c).count(); }
 
     /// \brief Returns the number of Kings on the board with Color \p c.
-    Short kingCount(Color c)     const { return _colorToKingBits.at(c).count();     }
+    Short kingCount(Color c)     const { return kingBits(c).count();     }
 
     /// \brief Returns the number of Queens on the board with Color \p c.
-    Short queenCount(Color c)    const { return _colorToQueenBits.at(c).count();    }
+    Short queenCount(Color c)    const { return queenBits(c).count();    }
 
     /// \brief Returns the number of Rooks on the board with Color \p c.
-    Short rookCount(Color c)     const { return _colorToRookBits.at(c).count();     }
+    Short rookCount(Color c)     const { return rookBits(c).count();     }
 
     /// \brief Returns the number of Bishops on the board with Color \p c.
-    Short bishopCount(Color c)   const { return _colorToBishopBits.at(c).count();   }
+    Short bishopCount(Color c)   const { return bishopBits(c).count();   }
 
     /// \brief Returns the number of Knights on the board with Color \p c.
-    Short knightCount(Color c)   const { return _colorToKnightBits.at(c).count();   }
+    Short knightCount(Color c)   const { return knightBits(c).count();   }
 
     /// \brief Returns the number of Pawns on the board with Color \p c.
-    Short pawnCount(Color c)     const { return _colorToPawnBits.at(c).count();     }
+    Short pawnCount(Color c)     const { return pawnBits(c).count();     }
 
     // ========================================
     // Other piece location methods
@@ -255,10 +265,18 @@ public:
     // ========================================
     // Board hashing
 
-    /// \brief Returns the Zobrist hash of the board, given its current layout.
-    ZHash zobristHash() const;
+    /// \brief Returns the Zobrist hash of the board: its layout, side to move, and en passant cell.
+    ///
+    /// This is maintained incrementally as pieces are placed, moved, and removed.
+    ZHash zobristHash() const { return _pos.zHash; }
+
+    /// \brief Recomputes the Zobrist hash of the board from scratch. Used to verify zobristHash().
+    ZHash zobristHashRecompute() const;
 
-    bool isRepetition() const;
+    /// \brief Returns whether the current position occurred at least \p priorCount times
+    ///        before, on the line of play leading to it (including moves made by makeMove).
+    ///        Use 1 for draw detection in search, and 2 for threefold repetition.
+    bool isRepetition(Short priorCount=1) const;
 
     // ========================================
     // String methods
@@ -276,41 +294,53 @@ public:
     // ========================================
     // Finding, getting, and caching moves
 
-    void recordObstructedHexRayCore(Index obsIndex, Index rayStart, const HexDir& rayDir) cache_const;
-    const HexRayCores getObstructedHexRayCores(Index obsIndex) cache_const;
-
     /// \brief Outputs to \p moves_first (a collection of Move objects) the pseudo-legal moves for a
     ///     "leaper" piece at location \p index with PieceType \pt and Color \c.
     ///
-    /// (The possible destinations of the piece are passed in as the argument \p dests.)
-    void findLeapMoves(/* out */ Moves& moves,
-        Index from, Color mover, PieceType pt, const Indices& dests
+    /// (The cells the piece attacks are passed in as the argument \p attacks.)
+    void findLeapMoves(/* out */ VariantMoveList& moves,
+        Index from, Color mover, PieceType pt, const typename V::Bits& attacks
         ) const;
 
     /// \brief Outputs to \p moves_first (a collection of Move objects) the pseudo-legal moves for a
     ///     "slider" piece at location \p index with PieceType \pt and Color \c.
     ///
-    /// (The possible slide directions of the piece are passed in as the argument \p rays.)
-    void findSlideMoves(/* out */ Moves& moves,
-        Index from, Color mover, PieceType pt, const HexRays<V>& rays, bool isVirtual=false
+    /// (The attacked cells are looked up in SliderAttacks, given the current occupancy.)
+    void findSlideMoves(/* out */ VariantMoveList& moves,
+        Index from, Color mover, PieceType pt
         ) const;
 
     /// \brief Outputs to \p moves_first (a collection of Move objects) the pseudo-legal moves for a
     ///     Pawn at location \p index with Color \c.
     ///
     /// (The Variant class has info on the Pawn's available advance and capture capabilities.)
-    void findStandardPawnMoves(/* out */ Moves& moves,
-        Index from, Color mover
+    /// Only moves to \p targets are output. An en passant capture counts as reaching \p targets
+    /// if either the cell moved to or the cell of the captured Pawn is in \p targets.
+    void findStandardPawnMoves(/* out */ VariantMoveList& moves,
+        Index from, Color mover, const typename V::Bits& targets=V::Bits::all()
+        ) const;
+
+    /// \brief Outputs to \p moves the pseudo-legal moves of all Pawns of Color \p mover at \p pawns,
+    ///     as in findStandardPawnMoves.
+    ///
+    /// The destinations of each kind of Pawn move (single step, double step, and capture in each
+    /// direction) are found for all the Pawns at once, by shifting \p pawns along the hex axes.
+    /// En passant captures are output last.
+    void findPawnMoves(/* out */ VariantMoveList& moves,
+        Color mover, const typename V::Bits& pawns, const typename V::Bits& targets=V::Bits::all()
         ) const;
 
     /// \brief Outputs to \p moves_first (a collection of Move objects) the pseudo-legal moves for a
     ///     piece with PieceType \pt and Color \c at location \index.
-    void findPseudoLegalMoves(/* out */ Moves& moves,
-        Index index, Color mover, PieceType pt, bool isVirtual=false
+    ///
+    /// Only moves to \p targets are output (with en passant as in findStandardPawnMoves).
+    void findPseudoLegalMoves(/* out */ VariantMoveList& moves,
+        Index index, Color mover, PieceType pt,
+        const typename V::Bits& targets=V::Bits::all(), bool isVirtual=false
         ) const;
 
-    /// \todo PERFORMANCE: Check if this should direct output to an iterator argument
-    void findPseudoLegalMoves(/* out */ Moves& moves, Color mover) const;
+    void findPseudoLegalMoves(/* out */ VariantMoveList& moves,
+        Color mover, const typename V::Bits& targets=V::Bits::all()) const;
 
 private:
     bool _moveSanityCheck(const Move& move) const;
@@ -321,147 +351,98 @@ public:
     // ----------------------------------------
 
     bool isOwnKingAttackedAfterOwnMove(const Move& move) const {
-        Scope scope{"Board::isOwnKingAttackedAfterOwnMove"};
-
-        if (move.pieceType() == PieceType::King) {
-            Index kIndex = getKingIndex(move.mover());
-            Board b = shallowCopyMove("Board_isOwnKingAttackedAfterOwnMove_Copy", move);
-            print(std::cout, scope(), "Board=", name(), ", counter=", currentCounter(),
-                ". Calling moveExec on shallow copy of board. Move=",
-                move.move_pgn_string(false), "\n");
-            b.moveExec(move);
-            for (const Move& candMove : b.getPseudoLegalMoves(b.mover())) {
-                if (candMove.to() == kIndex) {
-                    return true;
-                }
-            }
-            return false;
-        } else {
-            return _isKingAttackedAfterMove(move, move.mover());
-        }
+        return _isKingAttackedAfterMove(move, move.mover());
     }
 
     bool isPseudoLegalMoveLegal(const Move& candMove) const {
-        Scope scope{"Board::isPseudoLegalMoveLegal"};
-
-        Color mover = candMove.mover();
-        if (candMove.pieceType() == PieceType::King) {
-            Board b = shallowCopyMove("Board_FindLegalMoves_Copy", candMove);
-            print(std::cout, scope(), "Board=", name(), ", counter=", currentCounter(),
-                ". Calling moveExec for a shallow copy of the board\n");
-            b.moveExec(candMove);
-            const Moves& quasiLegalMoves = b.getPseudoLegalMoves(b.mover());
-            for (const Move& qlMove : quasiLegalMoves) {
-                if (qlMove.to() == getKingIndex(mover)) {
-                    return false;
-                }
-            }
-            return true;
-        } else if (!isOwnKingAttackedAfterOwnMove(candMove)) {  // Can re-use cached move info
-            return true;
-        }
-        return false;  // NOT_REACHED
+        return !isOwnKingAttackedAfterOwnMove(candMove);
     }
 
-    void findLegalMoves(/* out */ Moves& moves, Color c, const Moves& pseudoLegalMoves) const
-    {
-        Scope scope{"Board::findLegalMoves"};
+    /// \brief Outputs to \p moves the legal moves of Color \p c. Does not allocate.
+    ///
+    /// If \p c's King is in check, this defers to findEvasionMoves. Otherwise, those of
+    /// \p c's pieces that are pinned to its King are found once, by looking along each line
+    /// through the King, and each pseudo-legal move is tested against them. King moves and
+    /// en passant captures, which can expose the King in other ways, are tested with the
+    /// occupancy after the move.
+    ///
+    /// Only moves to \p targets are output (with en passant as in findStandardPawnMoves),
+    /// so that, e.g., captures and quiet moves can be generated separately, as by MovePicker.
+    void findLegalMoves(/* out */ VariantMoveList& moves,
+        Color c, const typename V::Bits& targets=V::Bits::all()) const;
 
-        for (const Move& candMove : pseudoLegalMoves) {
-            if (isPseudoLegalMoveLegal(candMove)) {
-                moves.push_back(candMove);
-            }
-        }
-    }
+    /// \brief Outputs to \p moves the legal moves of Color \p c, whose King is attacked by
+    ///        the pieces at \p checkers.
+    ///
+    /// Only King moves to unattacked cells are generated, plus (if there is a single checker)
+    /// moves by unpinned pieces that capture the checker or block its line to the King.
+    void findEvasionMoves(/* out */ VariantMoveList& moves,
+        Color c, const typename V::Bits& checkers,
+        const typename V::Bits& targets=V::Bits::all()) const;
+
+    /// \brief Returns whether \p move is legal for the mover on this Board, without generating
+    ///        moves. Used to vet Moves that come from elsewhere (e.g., killer or hash moves).
+    bool isLegalMove(const Move& move) const;
 
     void recordLegalMoves(const Moves& moves) cache_const;
     const Moves getLegalMoves(Color mover) cache_const;  // Get through cache
     CheckEnum setLegalMoveCheckEnums(Color mover) cache_const;
 
-    // Note: As currently defined, this can't be used to test spaces between King & Rook
+    /// \brief Determine if a specific cell is attacked by the mover. Unlike a test of the mover's
+    ///        legal moves, this includes cells the mover could only reach by exposing its King.
     bool isOpponentCellAttacked(Index tgtIndex) cache_const {
-        for (const Move& move : getLegalMoves(mover())) {
-            if (move.to() == tgtIndex) {
-                return true;
-            }
-            return false;
-        }
+        return attackersTo(tgtIndex, mover()).any();
     }
 
     /// \brief Determine if a specific cell is attacked. Can be used to determine Castling availability.
     ///
     /// Note: Does not execute any moves, nor does it rely on cached move information.
-    bool isOwnCellAttacked(Index tgtIndex) cache_const {
-        for (auto [from, c, pt] : piecesDense(opponent(mover()))) {
-            switch(pt) {
-            case PieceType::King:
-                for (Index kDest : V::kingDests.at(from)) {
-                    if (kDest == from) {
-                        return true;
-                    }
-                }
-                break;
-            case PieceType::Queen:
-                for (HexRay qRay : V::queenRays.at(from)) {
-                    if (qRay.contains(from)) {
-                        for (Index dest : qRay.indices()) {
-                            if (isPieceAt(dest)) {
-                                if (dest == tgtIndex) {
-                                    return true;
-                                }
-                                break;
-                            }
-                        }
-                    }
-                }
-                break;
-            case PieceType::Rook:
-                for (HexRay rRay : V::rookRays.at(from)) {
-                    if (rRay.contains(from)) {
-                        for (Index dest : rRay.indices()) {
-                            if (isPieceAt(dest)) {
-                                if (dest == tgtIndex) {
-                                    return true;
-                                }
-                                break;
-                            }
-                        }
-                    }
-                }
-                break;
-            case PieceType::Bishop:
-                for (HexRay bRay : V::bishopRays.at(from)) {
-                    if (bRay.contains(from)) {
-                        for (Index dest : bRay.indices()) {
-                            if (isPieceAt(dest)) {
-                                if (dest == tgtIndex) {
-                                    return true;
-                                }
-                                break;
-                            }
-                        }
-                    }
-                }
-                break;
-            case PieceType::Knight:
-                for (Index nDest : V::knightDests.at(from)) {
-                    if (nDest == from) {
-                        return true;
-                    }
-                }
-                break;
-            case PieceType::Pawn:
-                if (V::pawnCaptureBits(from, opponent(mover())).test(tgtIndex)) {
-                    return true;
-                }
-                // TODO: En passant capture
-                break;
-            }
-        }
-        return false;
-    }
+    bool isOwnCellAttacked(Index tgtIndex) cache_const;
+
+    /// \brief Returns the cells holding pieces (of either Color) that attack \p tgtIndex, with
+    ///        sliders blocked only by the cells in \p occupancy.
+    ///
+    /// This works in reverse from the target: e.g., the Rooks and Queens attacking it are those
+    /// on the cells a Rook at \p tgtIndex would attack, and likewise for the other piece types.
+    /// Passing an occupancy other than the Board's allows, e.g., testing a cell after a move.
+    typename V::Bits attackersTo(Index tgtIndex, const typename V::Bits& occupancy) const;
+
+    /// \brief Returns the cells holding pieces of Color \p attacker that attack \p tgtIndex,
+    ///        with sliders blocked only by the cells in \p occupancy.
+    typename V::Bits attackersTo(Index tgtIndex, Color attacker, const typename V::Bits& occupancy) const;
+
+    /// \brief Returns the cells holding pieces of Color \p attacker that attack \p tgtIndex.
+    typename V::Bits attackersTo(Index tgtIndex, Color attacker) const;
+
+    /// \brief Returns whether a piece of PieceType \p pt and Color \p c at \p from attacks \p tgt,
+    ///        given the Board's occupancy. (The piece need not actually be at \p from.)
+    bool isAttacking(Index from, Color c, PieceType pt, Index tgt) const;
 
-    bool isAttacking(Index from, Color, PieceType pt, Index tgt) const;
+    /// \brief Returns the cells a piece of PieceType \p pt and Color \p c at \p from attacks,
+    ///        given the Board's occupancy. (The piece need not actually be at \p from.)
+    typename V::Bits pieceAttacks(Index from, Color c, PieceType pt) const;
+
+    // ----------------------------------------
+    // Attack maps
+
+    /// \brief Turns the incremental maintenance of attack maps on or off.
+    ///
+    /// While on, every change to a cell's occupancy (e.g., by moveExec or moveUndo) updates the
+    /// attacks of the piece on that cell, and of the sliders whose lines pass through it.
+    /// It is off by default, so that, e.g., perft need not pay for it.
+    void setIsTrackingAttacks(bool isTracking);
+    bool isTrackingAttacks() const { return _optAttackMaps.has_value(); }
+    const std::optional<AttackMaps<V>>& getAttackMaps() const { return _optAttackMaps; }
+
+    /// \brief Returns the cells attacked by Color \p c. (Computed from scratch if not tracking.)
+    typename V::Bits attackedBits(Color c) const;
+
+    /// \brief Returns how many of Color \p c's pieces attack \p index.
+    ///        (Computed from scratch if not tracking.)
+    Short attackerCount(Index index, Color c) const;
+
+    /// \brief Returns attack maps computed from scratch, e.g., to check the tracked ones.
+    AttackMaps<V> attackMapsRecompute() const;
 
     // ----------------------------------------
 
@@ -485,6 +466,29 @@ public:
     void moveRedo(const Move& move);
     void moveUndo(const Move& move);
 
+    /// \brief What unmakeMove needs to restore, beyond what the Move itself records
+    ///        (e.g., the captured PieceType). Fixed-size, so search can keep one per ply.
+    struct UndoInfo {
+        OptIndex optEpIndex;
+        Short nonProgressCounter;
+        ZHash zHash;
+    };
+
+    /// \brief Makes \p move, recording in \p undo what unmakeMove needs. For game tree search.
+    ///
+    /// Unlike moveExec, this keeps no game history beyond the hash history used by isRepetition,
+    /// and does no logging or (in release builds) consistency checks.
+    /// Positions reached this way should be left only by unmakeMove (or setPosition).
+    void makeMove(const Move& move, /* out */ UndoInfo& undo);
+
+    /// \brief Makes \p move, for copy-make search: the caller saves position() beforehand,
+    ///        and later restores it with setPosition, instead of calling unmakeMove.
+    void makeMove(const Move& move);
+
+    /// \brief Takes back \p move, which must be the last move made by makeMove, given
+    ///        the UndoInfo recorded by that call.
+    void unmakeMove(const Move& move, const UndoInfo& undo);
+
     // ========================================
     // Reading and writing game state
 
@@ -548,54 +552,55 @@ private:
     const std::string _name;
     bool _isKingAttackedAfterMove(const Move& mover, Color kColor) const;
 
-    // =======================================
-    // Piece locations
+    /// \brief Returns \p c's pieces pinned to its King, and outputs them per line through the King.
+    typename V::Bits _findPinned(
+        /* out */ std::array<typename V::Bits, SliderAttacks<V>::LINE_COUNT>& pinnedOnLine,
+        Color c) const;
 
-    typename V::Bits _anyPieceBits;
-    std::map<Color, typename V::Bits> _colorToAnyPieceBits;
-    std::map<Color, typename V::Bits> _colorToKingBits;
-    std::map<Color, typename V::Bits> _colorToQueenBits;
-    std::map<Color, typename V::Bits> _colorToRookBits;
-    std::map<Color, typename V::Bits> _colorToBishopBits;
-    std::map<Color, typename V::Bits> _colorToKnightBits;
-    std::map<Color, typename V::Bits> _colorToPawnBits;
+    // =======================================
+    // Position: Piece locations, mover, en passant cell, counters, and Zobrist hash
 
-    std::map<Color, Index> _colorToKingIndex;
+    Position<V> _pos{};
 
     // =======================================
     // Move piece support
     void _bitsConsistencyTest() const;
-    void _bitsMove(std::map<Color, typename Glinski::Bits>& bits,
-        Color mover, Index from, Index to);
     void _bitsMove(typename Glinski::Bits& bits,
         Index from, Index to);
     void _bitsReset(Index index, Color c, PieceType pt);
+    void _bitsSet(Index index, Color c, PieceType pt);
+    void _bitsMovePiece(Index from, Index to, Color c, PieceType pt);
+
+    /// \brief Updates the pieces (but not the mover, en passant cell, counters, or history)
+    ///        to reflect \p move, or to take it back.
+    void _makeMovePieces(const Move& move);
+    void _unmakeMovePieces(const Move& move);
+    void _zobristConsistencyTest() const;
+
+    /// \brief If tracking attacks, updates the attack maps after the occupancy of \p index changed.
+    void _attackMapsUpdate(Index index);
+    void _attackMapsConsistencyTest() const;
+
+    /// \brief Present only while tracking attacks. See setIsTrackingAttacks.
+    std::optional<AttackMaps<V>> _optAttackMaps{std::nullopt};
 
     // =======================================
     // Non-piece data
 
-    Color _mover /* = Color::Black */;
-
-    /// \brief Returns which board location (if any) has an en passant cell.
-    ///
-    /// (Definition: An en passant cell is one that was skipped over by a Pawn in the opponent's
-    /// previous move, in a variant that supports en passant capture.)
-    /// Put en passant code here
-    OptIndex _optEpIndex{std::nullopt};
+    void _setMover(Color mover);
+    void _setOptEpIndex(OptIndex optEpIndex);
 
     // =======================================
     // Game history
 
     Moves _moveStack{};
 
-    /// \brief For each HalfMoveCounter, counter ticks since capture or Pawn move.
-    Short _nonProgressCounter{0};
+    /// \brief The nonProgressCounter before each move in _moveStack, restored by moveUndo.
     Shorts _nonProgressCounters{};
-    HalfMoveCounter _currentCounter{0};
 
-    // Hash history
-    std::map<ZHash, std::vector<HalfMoveCounter>> _zHashToCounters{};  // To track repeats
-    std::vector<ZHash> _zHashes{};  // One per counter, to track when a repeated Board position occurred
+    /// \brief The Zobrist hash of each position before the current one, oldest first, pushed by
+    ///        moveExec and makeMove (and popped on undo), to detect repeated positions.
+    std::vector<ZHash> _zHashes{};
 
     // =======================================
     // Caching
@@ -603,46 +608,89 @@ private:
     /// Each cache item is initliazed to empty, and filled via getter calls.
     /// This caching layer allows (computer) Players to determine if and when
     ///     they compute this info for games inspected during game tree search.
+    ///
+    /// Clearing only bumps a generation counter: entries stamped with an older generation are
+    /// stale, so no storage is freed or reallocated as moves are made and taken back.
     struct Cache {
-        Cache()
-            : mhashToCheckEnum{},
-              obstructedHexRayMap{},
-              optPseudoLegalMoves{},
-              optLegalMoves{},
-              optCheckEnum{},
-              optOutcome{},
-              lastCleared{-1}
-        { }
+        using Generation = std::uint32_t;
+
+        /// \brief An open-addressed table from Move hashes to CheckEnums, holding at least
+        ///        the moves of any one position. When full, an entry is simply overwritten.
+        class MoveCheckEnumTable {
+        public:
+            std::optional<CheckEnum> find(MHash key, Generation generation) const {
+                for (Size k = 0, slot = _home(key); k < SLOT_COUNT; ++k, slot = (slot + 1) & (SLOT_COUNT - 1)) {
+                    const Entry& e = _entries[slot];
+                    if (e.generation != generation) {
+                        return std::nullopt;  // An empty (stale) slot ends the probe sequence
+                    }
+                    if (e.key == key) {
+                        return e.checkEnum;
+                    }
+                }
+                return std::nullopt;
+            }
+
+            void insert(MHash key, CheckEnum ce, Generation generation) {
+                Size slot = _home(key);
+                for (Size k = 0; k < SLOT_COUNT; ++k, slot = (slot + 1) & (SLOT_COUNT - 1)) {
+                    const Entry& e = _entries[slot];
+                    if (e.generation != generation || e.key == key) {
+                        break;
+                    }
+                }
+                _entries[slot] = Entry{key, generation, ce};
+            }
+
+            /// \brief Marks every entry stale for all Generations but 0.
+            void reset() { _entries.fill(Entry{}); }
+
+        private:
+            static constexpr Short SLOT_BITS = 10;
+            static constexpr Size SLOT_COUNT = Size{1} << SLOT_BITS;
+            static_assert(SLOT_COUNT > V::MAX_MOVE_COUNT);
+
+            struct Entry {
+                MHash key{0};
+                Generation generation{0};
+                CheckEnum checkEnum{CheckEnum::None};
+            };
+
+            static Size _home(MHash key) {  // Fibonacci hashing
+                return static_cast<Size>((key * 0x9E3779B97F4A7C15ull) >> (64 - SLOT_BITS));
+            }
+
+            std::array<Entry, SLOT_COUNT> _entries{};
+        };
 
         void clear(Short counter) {
-            mhashToCheckEnum.clear();
-            obstructedHexRayMap.clear();
-            optPseudoLegalMoves = std::nullopt;
-            optLegalMoves = std::nullopt;
+            if (++generation == 0) {  // Wrapped around: stale stamps could look current
+                moveCheckEnums.reset();
+                pseudoLegalMovesGeneration = 0;
+                legalMovesGeneration = 0;
+                generation = 1;
+            }
             optCheckEnum = std::nullopt;
             optOutcome = std::nullopt;
             lastCleared = counter;
         }
 
-        std::map<MHash, CheckEnum> mhashToCheckEnum;
-
-        /// \brief Storage of slides of pieces that are blocked by opponent's pieces.
-        ///
-        /// This pseudo-legal moves that are *not* legal are those that unblock
-        /// attacks by the opponent's slider pieces. So we cache such incidents
-        /// in the form (objstructionIndex, (startIndex, dir)).
-        ///
-        /// Unlike the other values in the Board Cache, this one is not wrapped
-        /// by std::optional, because its computation is not computed in a single
-        /// function call, but rather distributed across the construction of the
-        /// HexRays of the sliding pieces.
-        ObstructedHexRayMap obstructedHexRayMap;
-
-        OptMoves       optPseudoLegalMoves;
-        OptMoves       optLegalMoves;
-        OptCheckEnum   optCheckEnum;
-        OptGameOutcome optOutcome;
-        Short          lastCleared;
+        bool hasPseudoLegalMoves() const { return pseudoLegalMovesGeneration == generation; }
+        bool hasLegalMoves() const { return legalMovesGeneration == generation; }
+
+        Generation generation{1};
+
+        MoveCheckEnumTable moveCheckEnums{};
+
+        /// \brief Valid only if stamped with the current generation. Capacity is kept for reuse.
+        Moves      pseudoLegalMoves{};
+        Generation pseudoLegalMovesGeneration{0};
+        Moves      legalMoves{};
+        Generation legalMovesGeneration{0};
+
+        OptCheckEnum   optCheckEnum{};
+        OptGameOutcome optOutcome{};
+        Short          lastCleared{-1};
     };
     cache_mutable Cache _cache{};
 };
@@ -14,6 +14,7 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <map>
+#include <stdexcept>
 #include <vector>
 
 #include "geometry.h"
@@ -84,6 +85,15 @@ const HexDirs BoardDir::knightLeapDirs {
     HexDir( 3,  1)
 };
 
+DirIndex BoardDir::dirIndex(const HexDir& dir) {
+    for (DirIndex d = 0; d < DIR_COUNT; ++d) {
+        if (steps[d].hex0 == dir.hex0 && steps[d].hex1 == dir.hex1) {
+            return d;
+        }
+    }
+    throw std::logic_error{"BoardDir::dirIndex: Unrecognized direction"};
+}
+
 HexDir operator-(const HexPos& p1, const HexPos& p2) {
     return HexDir{p1.hex0 - p2.hex0, p1.hex1 - p2.hex1};
 }
@@ -46,6 +46,15 @@ std::ostream& operator<<(std::ostream& os, const HexDir& d);
 
 using HexDirs = std::vector<HexDir>;
 
+/// \brief Identifies one of the steps a piece can take from a cell. See BoardDir::steps.
+using DirIndex = int;
+
+/// \brief A HexDir usable in constant expressions, for building lookup tables at compile time.
+struct DirStep {
+    HexCoord hex0;
+    HexCoord hex1;
+};
+
 
 struct BoardDir {
     // Orthogonal directions
@@ -69,6 +78,30 @@ struct BoardDir {
     static const HexDirs allDirs;   ///< \brief All "orthogonal" and "diagonal" directions
 
     static const HexDirs knightLeapDirs;  // \brief The 12 directions that a Knight can leap in hexagonal coordinates
+
+    static constexpr DirIndex ORTHO_DIR_BEGIN  = 0;   ///< \brief First of the 6 orthogonal steps
+    static constexpr DirIndex DIAG_DIR_BEGIN   = 6;   ///< \brief First of the 6 diagonal steps
+    static constexpr DirIndex KNIGHT_DIR_BEGIN = 12;  ///< \brief First of the 12 Knight leaps
+    static constexpr DirIndex SLIDE_DIR_COUNT  = 12;  ///< \brief Orthogonal and diagonal steps
+    static constexpr DirIndex DIR_COUNT        = 24;  ///< \brief All steps, including Knight leaps
+
+    /// \brief Every step, in the order of allDirs followed by knightLeapDirs.
+    static constexpr DirStep steps[DIR_COUNT] {
+        { 1,  1}, { 0,  1}, {-1,  0}, {-1, -1}, { 0, -1}, { 1,  0},  // NE, N, NW, SW, S, SE
+        { 2,  1}, { 1,  2}, {-1,  1}, {-2, -1}, {-1, -2}, { 1, -1},  // E, NNE, NNW, W, SSW, SSE
+        { 3,  2}, { 2,  3}, { 1,  3}, {-1,  2}, {-2,  1}, {-3, -1},  // Knight leaps
+        {-3, -2}, {-2, -3}, {-1, -3}, { 1, -2}, { 2, -1}, { 3,  1}
+    };
+
+    /// \brief Returns the DirIndex of \p dir within steps. Throws if \p dir is not one of them.
+    static DirIndex dirIndex(const HexDir& dir);
+
+    /// \brief Returns the DirIndex of the step opposite to step \p d.
+    static constexpr DirIndex reverseDir(DirIndex d) {
+        return d < KNIGHT_DIR_BEGIN
+            ? d - d % 6 + (d % 6 + 3) % 6
+            : KNIGHT_DIR_BEGIN + (d - KNIGHT_DIR_BEGIN + 6) % 12;
+    }
 };
 
 
@@ -0,0 +1,226 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include <bit>
+#include <iterator>
+#include <string>
+
+#include "util_hexchess.h"
+
+
+namespace hexchess::core {
+
+/// \brief A set of board cells, with one bit per cell, stored in two 64-bit lanes.
+///
+/// This replaces std::bitset, which has no portable way to find the lowest set bit.
+/// Bit k represents the cell with Index k. Bits at or beyond \p BIT_COUNT are always zero,
+/// so that count(), operator~, and the shift operators stay within the board.
+///
+/// Iterating over a HexBits (e.g., `for (Index index : bits)`) visits only the set bits,
+/// in increasing order of Index.
+template <Short BIT_COUNT>
+class HexBits {
+public:
+    static_assert(BIT_COUNT > 0 && BIT_COUNT <= 128, "HexBits supports at most 128 cells");
+
+    using Lane = std::uint64_t;
+    static constexpr Short LANE_BITS = 64;
+
+    /// \brief Iterates over the set bits of a HexBits, from lowest to highest Index.
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Index;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Index*;
+        using reference = Index;
+
+        constexpr Iterator() : _bits{} {}
+        constexpr explicit Iterator(const HexBits& bits) : _bits{bits} {}
+
+        constexpr Index operator*() const { return _bits.lsb(); }
+        constexpr Iterator& operator++() { _bits.popLsb(); return *this; }
+        constexpr Iterator operator++(int) { Iterator result{*this}; _bits.popLsb(); return result; }
+        constexpr bool operator==(const Iterator& other) const { return _bits == other._bits; }
+
+    private:
+        HexBits _bits;
+    };
+
+    // ========================================
+    // Constructors
+
+    constexpr HexBits() : _lo{0}, _hi{0} {}
+    constexpr HexBits(Lane lo, Lane hi) : _lo{lo & _loMask()}, _hi{hi & _hiMask()} {}
+
+    /// \brief Returns a HexBits with only the bit for Index \p index set.
+    static constexpr HexBits fromIndex(Index index) { return HexBits{}.set(index); }
+
+    /// \brief Returns a HexBits with every bit set (i.e., every cell on the board).
+    static constexpr HexBits all() { return ~HexBits{}; }
+
+    // ========================================
+    // Single-bit access
+
+    constexpr bool test(Index index) const {
+        assert(index >= 0 && index < BIT_COUNT);
+        return index < LANE_BITS
+            ? (_lo >> index) & 1
+            : (_hi >> (index - LANE_BITS)) & 1;
+    }
+    constexpr bool operator[](Index index) const { return test(index); }
+
+    constexpr HexBits& set(Index index) {
+        assert(index >= 0 && index < BIT_COUNT);
+        if (index < LANE_BITS) {
+            _lo |= Lane{1} << index;
+        } else {
+            _hi |= Lane{1} << (index - LANE_BITS);
+        }
+        return *this;
+    }
+    constexpr HexBits& set(Index index, bool value) {
+        return value ? set(index) : reset(index);
+    }
+    constexpr HexBits& reset(Index index) {
+        assert(index >= 0 && index < BIT_COUNT);
+        if (index < LANE_BITS) {
+            _lo &= ~(Lane{1} << index);
+        } else {
+            _hi &= ~(Lane{1} << (index - LANE_BITS));
+        }
+        return *this;
+    }
+    constexpr HexBits& reset() { _lo = 0; _hi = 0; return *this; }
+    constexpr HexBits& flip(Index index) {
+        assert(index >= 0 && index < BIT_COUNT);
+        if (index < LANE_BITS) {
+            _lo ^= Lane{1} << index;
+        } else {
+            _hi ^= Lane{1} << (index - LANE_BITS);
+        }
+        return *this;
+    }
+
+    // ========================================
+    // Whole-set queries
+
+    constexpr Short size() const { return BIT_COUNT; }
+    constexpr Short count() const { return std::popcount(_lo) + std::popcount(_hi); }
+    constexpr Short popcount() const { return count(); }
+    constexpr bool any() const { return (_lo | _hi) != 0; }
+    constexpr bool none() const { return !any(); }
+
+    /// \brief Returns the lowest Index whose bit is set. Requires any().
+    constexpr Index lsb() const {
+        assert(any());
+        return _lo != 0
+            ? std::countr_zero(_lo)
+            : LANE_BITS + std::countr_zero(_hi);
+    }
+
+    /// \brief Clears the lowest set bit, and returns its Index. Requires any().
+    constexpr Index popLsb() {
+        Index result = lsb();
+        if (_lo != 0) {
+            _lo &= _lo - 1;
+        } else {
+            _hi &= _hi - 1;
+        }
+        return result;
+    }
+
+    constexpr Iterator begin() const { return Iterator{*this}; }
+    constexpr Iterator end() const { return Iterator{}; }
+
+    constexpr Lane lo() const { return _lo; }
+    constexpr Lane hi() const { return _hi; }
+
+    // ========================================
+    // Set operations
+
+    constexpr HexBits& operator&=(const HexBits& other) { _lo &= other._lo; _hi &= other._hi; return *this; }
+    constexpr HexBits& operator|=(const HexBits& other) { _lo |= other._lo; _hi |= other._hi; return *this; }
+    constexpr HexBits& operator^=(const HexBits& other) { _lo ^= other._lo; _hi ^= other._hi; return *this; }
+
+    constexpr HexBits operator~() const { return HexBits{~_lo, ~_hi}; }
+
+    friend constexpr HexBits operator&(HexBits a, const HexBits& b) { return a &= b; }
+    friend constexpr HexBits operator|(HexBits a, const HexBits& b) { return a |= b; }
+    friend constexpr HexBits operator^(HexBits a, const HexBits& b) { return a ^= b; }
+    friend constexpr bool operator==(const HexBits& a, const HexBits& b) = default;
+
+    /// \brief Shifts toward higher indices. Bits shifted past the last cell are dropped.
+    constexpr HexBits operator<<(Short n) const {
+        assert(n >= 0);
+        if (n == 0) {
+            return *this;
+        } else if (n >= 2 * LANE_BITS) {
+            return HexBits{};
+        } else if (n >= LANE_BITS) {
+            return HexBits{0, _lo << (n - LANE_BITS)};
+        }
+        return HexBits{_lo << n, (_hi << n) | (_lo >> (LANE_BITS - n))};
+    }
+
+    /// \brief Shifts toward lower indices. Bits shifted below Index 0 are dropped.
+    constexpr HexBits operator>>(Short n) const {
+        assert(n >= 0);
+        if (n == 0) {
+            return *this;
+        } else if (n >= 2 * LANE_BITS) {
+            return HexBits{};
+        } else if (n >= LANE_BITS) {
+            return HexBits{_hi >> (n - LANE_BITS), 0};
+        }
+        return HexBits{(_lo >> n) | (_hi << (LANE_BITS - n)), _hi >> n};
+    }
+
+    /// \brief Shifts by \p n cells (toward higher indices if positive), keeping only
+    ///        those results that lie within \p edgeMask.
+    constexpr HexBits shifted(Short n, const HexBits& edgeMask) const {
+        return (n >= 0 ? *this << n : *this >> -n) & edgeMask;
+    }
+
+    /// \brief Same format as std::bitset::to_string: highest Index first.
+    std::string to_string() const {
+        std::string result(BIT_COUNT, '0');
+        for (Index index : *this) {
+            result[BIT_COUNT - 1 - index] = '1';
+        }
+        return result;
+    }
+
+private:
+    static constexpr Lane _loMask() {
+        return BIT_COUNT >= LANE_BITS ? ~Lane{0} : (Lane{1} << BIT_COUNT) - 1;
+    }
+    static constexpr Lane _hiMask() {
+        return BIT_COUNT <= LANE_BITS ? Lane{0}
+             : BIT_COUNT == 2 * LANE_BITS ? ~Lane{0}
+             : (Lane{1} << (BIT_COUNT - LANE_BITS)) - 1;
+    }
+
+    Lane _lo;  ///< \brief Bits for Indices [0, 64)
+    Lane _hi;  ///< \brief Bits for Indices [64, BIT_COUNT)
+};
+
+}  // namespace hexchess::core
@@ -16,9 +16,11 @@
 #pragma once
 
 #include <cassert>
+#include <cstdint>
 
 #include <optional>
 #include <sstream>
+#include <type_traits>
 
 #include "util.h"
 #include "util_hexchess.h"
@@ -70,9 +72,21 @@ std::ostream& operator<<(std::ostream& os, MoveEnum me);
 /// \brief The record of a player Move.
 ///
 /// This class contain info to execute or undo a move.
+///
+/// All fields are packed into a single 32-bit code, so a Move is trivially copyable,
+/// Moves (and the Board's move stack) stay compact, and Move equality is one integer compare.
+/// Bit layout, from the least significant bit:
+///   [0, 7) from, [7, 14) to, [14, 17) PieceType, [17, 20) captured PieceType + 1 (or 0),
+///   [20, 23) promotion PieceType + 1 (or 0), [23, 25) MoveEnum, [25] mover,
+///   [26, 28) CheckEnum + 1 (or 0 if not yet determined).
 class Move {
 public:
-    Move(Color mover,
+    using Code = std::uint32_t;
+
+    /// \brief Leaves the Move uninitialized, so that MoveList storage costs nothing to create.
+    Move() = default;
+
+    constexpr Move(Color mover,
         PieceType pt,
         Index from,
         Index to,
@@ -81,67 +95,90 @@ public:
         OptPieceType optPromotedTo=std::nullopt,
         OptCheckEnum optCheckEnum=std::nullopt
         )
-        : _mover{mover},
-          _pieceType{pt},
-          _from{from},
-          _to{to},
-          _moveEnum{mt},
-          _optCaptured{optCaptured},
-          _optPromotedTo{optPromotedTo},
-          _optCheckEnum{optCheckEnum}
+        : _code{  _field(from, FROM_SHIFT)
+                | _field(to, TO_SHIFT)
+                | _field(pieceTypeIndex(pt), PIECE_TYPE_SHIFT)
+                | _field(_optPieceTypeCode(optCaptured), CAPTURED_SHIFT)
+                | _field(_optPieceTypeCode(optPromotedTo), PROMOTED_TO_SHIFT)
+                | _field(static_cast<Short>(mt), MOVE_ENUM_SHIFT)
+                | _field(colorIndex(mover), MOVER_SHIFT)
+                | _field(_optCheckEnumCode(optCheckEnum), CHECK_ENUM_SHIFT)}
     {
         assert(from != to);
-        assert(from >= 0 && from <= Glinski::CELL_COUNT);
-        assert(to >= 0 && to <= Glinski::CELL_COUNT);
+        assert(from >= 0 && from < Glinski::CELL_COUNT);
+        assert(to >= 0 && to < Glinski::CELL_COUNT);
     }
 
-    Move(const Move& other) = default;
-    ~Move() {};
-    Move& operator=(const Move& other);
-
-    Color mover() const         { return _mover; }
-    PieceType pieceType() const { return _pieceType; }
-    Index from() const          { return _from; }
-    Index to() const            { return _to; }
-    MoveEnum moveEnum() const   { return _moveEnum; }
+    constexpr Color mover() const         { return static_cast<Color>(_get(MOVER_SHIFT, 1)); }
+    constexpr PieceType pieceType() const { return static_cast<PieceType>(_get(PIECE_TYPE_SHIFT, 3)); }
+    constexpr Index from() const          { return _get(FROM_SHIFT, 7); }
+    constexpr Index to() const            { return _get(TO_SHIFT, 7); }
+    constexpr MoveEnum moveEnum() const   { return static_cast<MoveEnum>(_get(MOVE_ENUM_SHIFT, 2)); }
 
-    const OptPieceType optCaptured()   const { return _optCaptured; };
-    const OptPieceType optPromotedTo() const { return _optPromotedTo; };
+    constexpr OptPieceType optCaptured()   const { return _optPieceType(_get(CAPTURED_SHIFT, 3)); }
+    constexpr OptPieceType optPromotedTo() const { return _optPieceType(_get(PROMOTED_TO_SHIFT, 3)); }
 
-    OptCheckEnum optCheckEnum() const { return _optCheckEnum; }
-    bool hasCheckEnum() const { return _optCheckEnum.has_value(); }
-    CheckEnum checkEnum() const { return _optCheckEnum.value(); }
-    void setCheckEnum(CheckEnum ce) { _optCheckEnum = std::make_optional(ce); }
+    constexpr OptCheckEnum optCheckEnum() const {
+        Short ceCode = _get(CHECK_ENUM_SHIFT, 2);
+        return ceCode == 0 ? std::nullopt : std::make_optional(static_cast<CheckEnum>(ceCode - 1));
+    }
+    constexpr bool hasCheckEnum() const { return _get(CHECK_ENUM_SHIFT, 2) != 0; }
+    constexpr CheckEnum checkEnum() const { return optCheckEnum().value(); }
+    constexpr void setCheckEnum(CheckEnum ce) {
+        _code = (_code & ~_field(3, CHECK_ENUM_SHIFT)) | _field(_optCheckEnumCode(ce), CHECK_ENUM_SHIFT);
+    }
 
-    bool isCapture() const    { return _optCaptured != std::nullopt; }
-    bool isCastling() const   { return _moveEnum == MoveEnum::Castling; }
+    constexpr bool isCapture() const    { return _get(CAPTURED_SHIFT, 3) != 0; }
+    constexpr bool isCastling() const   { return moveEnum() == MoveEnum::Castling; }
 
     /// Note: Check and Checkmate are exclusive of each other. Checkmate is not a type of Check.
     bool isCheck() const;
     bool isCheckmate() const;
-    bool isEnPassant() const  { return _moveEnum == MoveEnum::EnPassant; }
+    constexpr bool isEnPassant() const  { return moveEnum() == MoveEnum::EnPassant; }
 
     /// \brief Used to determine whether to reset the nonProgressCounter.
-    bool isProgressMove() const;
-    bool isPromotion() const { return _moveEnum == MoveEnum::PawnPromotion; }
+    constexpr bool isProgressMove() const { return pieceType() == PieceType::Pawn || isCapture(); }
+    constexpr bool isPromotion() const { return moveEnum() == MoveEnum::PawnPromotion; }
 
     const std::string move_pgn_string(bool doChecks=true) const;
-    MHash getHash() const;
+
+    /// \brief Returns a value identifying the Move, regardless of whether its CheckEnum is known.
+    constexpr MHash getHash() const { return _code & ~_field(3, CHECK_ENUM_SHIFT); }
+
+    /// \brief Returns the packed representation of the Move, including its CheckEnum.
+    constexpr Code code() const { return _code; }
+
+    friend constexpr bool operator==(const Move& a, const Move& b) { return a._code == b._code; }
 
 private:
-    // class Board;
-    // const Board *_board;       ///< \brief Contains _mhashToCheckEnum
-    Color _mover;                 ///< \brief The player moving
-    PieceType _pieceType;         ///< \brief On castling, pieceType == PieceType::King
-    Index _from;                  ///< \brief The beginning position
-    Index _to;                    ///< \brief The ending position
-    MoveEnum _moveEnum;           ///< \brief The move type, to simplify Undo
-    OptPieceType _optCaptured;    ///< \brief The captured piece type (for Undo)
-    OptPieceType _optPromotedTo;  ///< \brief The chosen promotion type
-    mutable OptCheckEnum _optCheckEnum;  ///< \brief Duplicate of map value in Board
-
-friend bool operator==(const Move& a, const Move& b);
+    static constexpr Short FROM_SHIFT        = 0;
+    static constexpr Short TO_SHIFT          = 7;
+    static constexpr Short PIECE_TYPE_SHIFT  = 14;
+    static constexpr Short CAPTURED_SHIFT    = 17;
+    static constexpr Short PROMOTED_TO_SHIFT = 20;
+    static constexpr Short MOVE_ENUM_SHIFT   = 23;
+    static constexpr Short MOVER_SHIFT       = 25;
+    static constexpr Short CHECK_ENUM_SHIFT  = 26;
+
+    static constexpr Code _field(Short value, Short shift) { return static_cast<Code>(value) << shift; }
+    constexpr Short _get(Short shift, Short width) const {
+        return static_cast<Short>((_code >> shift) & ((Code{1} << width) - 1));
+    }
+
+    static constexpr Short _optPieceTypeCode(OptPieceType optPt) {
+        return optPt.has_value() ? pieceTypeIndex(optPt.value()) + 1 : 0;
+    }
+    static constexpr OptPieceType _optPieceType(Short ptCode) {
+        return ptCode == 0 ? std::nullopt : std::make_optional(static_cast<PieceType>(ptCode - 1));
+    }
+    static constexpr Short _optCheckEnumCode(OptCheckEnum optCe) {
+        return optCe.has_value() ? static_cast<Short>(optCe.value()) + 1 : 0;
+    }
+
+    Code _code;
 };
+static_assert(sizeof(Move) == sizeof(Move::Code));
+static_assert(std::is_trivially_copyable_v<Move>);
 
 // bool operator==(const Move& a, const Move& b);
 std::ostream& operator<<(std::ostream& os, const Move& move);
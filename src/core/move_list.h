@@ -0,0 +1,75 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cassert>
+
+#include <array>
+#include <utility>
+
+#include "move.h"
+#include "util_hexchess.h"
+
+
+namespace hexchess::core {
+
+/// \brief A list of at most \p CAPACITY Moves, stored inline (e.g., on the stack).
+///
+/// Move generation writes into a MoveList through an output parameter, so that
+/// generating moves at each node of a game tree search does not allocate.
+/// Iteration, size(), and push_back() mirror those of std::vector.
+template <Size CAPACITY>
+class MoveList {
+public:
+    using value_type = Move;
+    using iterator = Move*;
+    using const_iterator = const Move*;
+
+    constexpr MoveList() : _size{0} {}
+
+    constexpr void push_back(const Move& move) {
+        assert(_size < CAPACITY);
+        _moves[_size++] = move;
+    }
+    template <typename... Args>
+    constexpr Move& emplace_back(Args&&... args) {
+        assert(_size < CAPACITY);
+        return _moves[_size++] = Move{std::forward<Args>(args)...};
+    }
+    constexpr void pop_back() { assert(_size > 0); --_size; }
+    constexpr void clear() { _size = 0; }
+
+    constexpr Size size() const { return _size; }
+    constexpr bool empty() const { return _size == 0; }
+    static constexpr Size capacity() { return CAPACITY; }
+
+    constexpr Move& operator[](Size k)             { assert(k < _size); return _moves[k]; }
+    constexpr const Move& operator[](Size k) const { assert(k < _size); return _moves[k]; }
+
+    constexpr iterator begin()             { return _moves.data(); }
+    constexpr iterator end()               { return _moves.data() + _size; }
+    constexpr const_iterator begin() const { return _moves.data(); }
+    constexpr const_iterator end() const   { return _moves.data() + _size; }
+
+    /// \brief Returns a copy of the Moves, e.g., for caching or for sending to a Player.
+    Moves toMoves() const { return Moves(begin(), end()); }
+
+private:
+    std::array<Move, CAPACITY> _moves;  ///< \brief Only [0, _size) are initialized
+    Size _size;
+};
+
+}  // namespace hexchess::core
@@ -0,0 +1,255 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <optional>
+
+#include "board.h"
+#include "move.h"
+#include "move_list.h"
+#include "util_hexchess.h"
+#include "variant.h"
+
+
+namespace hexchess::core {
+
+/// \brief Yields the legal moves of the Board's mover one at a time, most promising first.
+///
+/// Moves are produced in stages, and a stage's moves are only generated once the
+/// previous stages are exhausted, so a search that cuts off early skips most generation:
+///     (1) the hash move (e.g., from a transposition table), if legal,
+///     (2) captures that do not lose material, ordered by MVV-LVA
+///         (Most Valuable Victim, then Least Valuable Attacker),
+///     (3) non-capturing Pawn promotions,
+///     (4) killer moves (quiet moves that caused cutoffs at the same ply), if legal,
+///     (5) the remaining quiet moves, and
+///     (6) captures that appear to lose material.
+/// Each legal move is yielded exactly once.
+///
+/// The Board must not be changed while the MovePicker is in use, except by making and
+/// unmaking moves that are undone before the next call to next().
+template <typename Variant>
+class MovePicker {
+public:
+    typedef Variant V;
+    using Bits = typename V::Bits;
+    using VariantMoveList = typename Board<V>::VariantMoveList;
+
+    static constexpr Short KILLER_COUNT = 2;
+    using Killers = std::array<OptMove, KILLER_COUNT>;
+
+    enum class Stage : Short {
+        HashMove, GenCaptures, GoodCaptures, GenQuiets, Promotions, Killers, Quiets, BadCaptures, Done
+    };
+
+    MovePicker(const Board<V>& b,
+               OptMove optHashMove=std::nullopt,
+               const Killers& killers=Killers{})
+        : _b{b},
+          _mover{b.mover()},
+          _optHashMove{optHashMove},
+          _killers{killers}
+    {}
+
+    /// \brief Returns the next move, or std::nullopt once all legal moves have been yielded.
+    OptMove next() {
+        while (true) {
+            switch (_stage) {
+            case Stage::HashMove:
+                _stage = Stage::GenCaptures;
+                if (_optHashMove.has_value() && _b.isLegalMove(_optHashMove.value()))
+                {
+                    return _optHashMove;
+                }
+                _optHashMove = std::nullopt;
+                break;
+
+            case Stage::GenCaptures: {
+                // The en passant cell is targeted, so that en passant captures are included.
+                Bits targets = _b.anyPieceBits(opponent(_mover));
+                if (_b.optEpIndex().has_value()) {
+                    targets.set(_b.optEpIndex().value());
+                }
+                VariantMoveList moves{};
+                _b.findLegalMoves(moves, _mover, targets);
+                for (const Move& move : moves) {
+                    if (move.isCapture()) {
+                        _captures.push_back(move);
+                    } else {
+                        _quiets.push_back(move);  // A quiet move to the en passant cell
+                    }
+                }
+                std::stable_sort(_captures.begin(), _captures.end(),
+                    [](const Move& a, const Move& b) { return captureScore(a) > captureScore(b); });
+                _cur = 0;
+                _stage = Stage::GoodCaptures;
+                break;
+            }
+
+            case Stage::GoodCaptures:
+                while (_cur < _captures.size()) {
+                    const Move move = _captures[_cur++];
+                    if (_isHashMove(move)) {
+                        continue;
+                    }
+                    if (_isLosingCapture(move)) {
+                        _captures[_badCaptureCount++] = move;  // Deferred to Stage::BadCaptures
+                        continue;
+                    }
+                    return move;
+                }
+                _cur = 0;
+                _stage = Stage::GenQuiets;
+                break;
+
+            case Stage::GenQuiets: {
+                Bits targets = ~_b.anyPieceBits();
+                if (_b.optEpIndex().has_value()) {
+                    targets.reset(_b.optEpIndex().value());  // Already generated with captures
+                }
+                _b.findLegalMoves(_quiets, _mover, targets);
+                _promotionCount = std::stable_partition(_quiets.begin(), _quiets.end(),
+                    [](const Move& move) { return move.isPromotion(); }) - _quiets.begin();
+                _cur = 0;
+                _stage = Stage::Promotions;
+                break;
+            }
+
+            case Stage::Promotions:
+                while (_cur < _promotionCount) {
+                    const Move& move = _quiets[_cur++];
+                    if (!_isHashMove(move)) {
+                        return move;
+                    }
+                }
+                _stage = Stage::Killers;
+                break;
+
+            case Stage::Killers:
+                while (_killerIndex < KILLER_COUNT) {
+                    const Short k = _killerIndex++;
+                    const OptMove& optKiller = _killers[k];
+                    // A killer is yielded only if it is one of this position's quiet moves.
+                    if (optKiller.has_value() && !_isHashMove(optKiller.value())
+                        && !_isYieldedKiller(optKiller.value())
+                        && std::find(_quiets.begin() + _promotionCount, _quiets.end(),
+                                     optKiller.value()) != _quiets.end())
+                    {
+                        _isKillerYielded[k] = true;
+                        return optKiller;
+                    }
+                }
+                _cur = _promotionCount;
+                _stage = Stage::Quiets;
+                break;
+
+            case Stage::Quiets:
+                while (_cur < _quiets.size()) {
+                    const Move& move = _quiets[_cur++];
+                    if (!_isHashMove(move) && !_isYieldedKiller(move)) {
+                        return move;
+                    }
+                }
+                _cur = 0;
+                _stage = Stage::BadCaptures;
+                break;
+
+            case Stage::BadCaptures:
+                if (_cur < _badCaptureCount) {
+                    return _captures[_cur++];
+                }
+                _stage = Stage::Done;
+                break;
+
+            case Stage::Done:
+                return std::nullopt;
+            }
+        }
+    }
+
+    /// \brief Returns the stage from which the next move will be sought.
+    Stage stage() const { return _stage; }
+
+    /// \brief Returns the MVV-LVA ordering score of a capture: higher is tried first.
+    static constexpr Value captureScore(const Move& move) {
+        Value victimValue = move.isCapture() ? exchangeValue(move.optCaptured().value()) : 0;
+        Value promotionGain = move.isPromotion()
+            ? exchangeValue(move.optPromotedTo().value()) - exchangeValue(PieceType::Pawn)
+            : 0;
+        // Ties in victim value go to the less valuable attacker, whose PieceType is later.
+        return 8 * (victimValue + promotionGain) + pieceTypeIndex(move.pieceType());
+    }
+
+    /// \brief Approximate piece values (in hundredths of a Pawn) used to order and vet captures.
+    static constexpr Value exchangeValue(PieceType pt) {
+        constexpr std::array<Value, 6> values{
+            10'000,  // King
+               666,  // Queen
+               446,  // Rook
+               260,  // Bishop
+               230,  // Knight
+               100   // Pawn
+        };
+        return values[pieceTypeIndex(pt)];
+    }
+
+private:
+    bool _isHashMove(const Move& move) const {
+        return _optHashMove.has_value() && move == _optHashMove.value();
+    }
+
+    bool _isYieldedKiller(const Move& move) const {
+        for (Short k = 0; k < KILLER_COUNT; ++k) {
+            if (_isKillerYielded[k] && move == _killers[k].value()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// \brief A cheap stand-in for static exchange evaluation: a capture is presumed to lose
+    ///        material if the capturing piece is worth more than its victim, and the
+    ///        opponent defends the cell captured on (including through the capturing piece).
+    bool _isLosingCapture(const Move& move) const {
+        if (move.pieceType() == PieceType::King) {
+            return false;  // Legal, so the cell is not defended
+        }
+        if (exchangeValue(move.pieceType()) <= exchangeValue(move.optCaptured().value())) {
+            return false;
+        }
+        Bits occupancy = _b.anyPieceBits();
+        occupancy.reset(move.from());
+        return _b.attackersTo(move.to(), opponent(_mover), occupancy).any();
+    }
+
+    const Board<V>& _b;
+    const Color _mover;
+    OptMove _optHashMove;
+    const Killers _killers;
+
+    Stage _stage{Stage::HashMove};
+    VariantMoveList _captures{};  ///< \brief [0, _badCaptureCount) are reused for bad captures
+    VariantMoveList _quiets{};    ///< \brief [0, _promotionCount) are Pawn promotions
+    Size _cur{0};
+    Size _badCaptureCount{0};
+    Size _promotionCount{0};
+    Short _killerIndex{0};
+    std::array<bool, KILLER_COUNT> _isKillerYielded{};
+};
+
+}  // namespace hexchess::core
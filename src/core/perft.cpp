@@ -0,0 +1,72 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <bit>
+#include <optional>
+#include <vector>
+
+#include "perft.h"
+
+using std::vector;
+
+
+namespace hexchess::core {
+
+PerftHashTable::PerftHashTable(Size sizeMb)
+    : _entries(std::bit_floor(std::max<Size>(1, sizeMb * 1024 * 1024 / sizeof(Entry))))
+{ }
+
+std::optional<NodeCount> PerftHashTable::find(ZHash key, Short depth) const {
+    const Entry& e = _entry(key);
+    const std::uint64_t data = e.data.load(std::memory_order_relaxed);
+    const std::uint64_t check = e.check.load(std::memory_order_relaxed);
+    if ((check ^ data) != key || (data & DEPTH_MASK) != static_cast<std::uint64_t>(depth)) {
+        return std::nullopt;
+    }
+    return data >> DEPTH_BITS;
+}
+
+void PerftHashTable::store(ZHash key, Short depth, NodeCount count) {
+    Entry& e = _entry(key);
+    const std::uint64_t data = (count << DEPTH_BITS) | static_cast<std::uint64_t>(depth);
+    e.data.store(data, std::memory_order_relaxed);
+    e.check.store(key ^ data, std::memory_order_relaxed);
+}
+
+// The counts below were confirmed (to depth 4) by a perft that generates pseudo-legal moves
+// and keeps those that do not leave the mover's King attacked, independently of the
+// check-evasion and pin logic of findLegalMoves.
+// The initial position is given literally, since Glinski::fenInitial is defined in another
+// translation unit, and so might not yet be initialized.
+const vector<PerftReference> glinskiPerftReferences{
+    {"Initial position",
+     "b/qk/nbn/r2r/p1b1p/1p2p1/1p1p1/2pp2/2p2/6/5/6/2P2/2PP2/1P1P1/1P2P1/P1B1P/R2R/NBN/QK/B w - - 1 1",
+     {51, 2'586, 137'858, 7'282'418}},
+    {"En passant (White may capture on H6)",
+     "b/qk/1bn/r3/p1b1p/1p2p1/1p3/3p2/1rp2/2pP2/1P1p1/1Pn3/2P2/2P3/3P1/2Q1P1/P1B1P/R2R/NBN/1K/B w - H6 13 7",
+     {63, 4'143, 260'777, 17'172'844}},
+    {"Promotion (a White Pawn may promote)",
+     "1/2/3/4/3kp/6/P4/4P1/2p2/6/1pPP1/4P1/5/6/3N1/6/3K1/r3/3/2/1 w - - 169 85",
+     {25, 638, 14'338, 367'827}},
+    {"Pin (a White Pawn is pinned to its King)",
+     "1/2/n2/r3/Q1b1p/1p1kp1/1p1pn/3p2/B1p2/2p1b1/q4/r2Pb1/2P2/2P1N1/2RP1/1P2P1/P1BRP/4/N2/2/K w - - 31 16",
+     {59, 4'694, 269'684, 20'734'267}},
+    {"Check (White is in check from a Queen)",
+     "1/2/1k1/4/4p/1p1rp1/1p1p1/1n1p2/2p2/2rb2/2P1P/1b2n1/R1R2/4N1/3P1/4P1/P1q2/2K1/3/2/N w - - 75 38",
+     {4, 327, 13'470, 1'081'224}},
+};
+
+}  // namespace hexchess::core
@@ -0,0 +1,236 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include <algorithm>
+#include <atomic>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "board.h"
+#include "move.h"
+#include "util_hexchess.h"
+#include "variant.h"
+#include "zobrist.h"
+
+
+namespace hexchess::core {
+
+/// \brief Returns the number of leaves of the legal move tree of depth \p depth below \p b:
+///        the standard "perft" measure of move generation correctness and speed.
+///
+/// At depth 1, the legal moves are counted in bulk rather than made. \p b is left unchanged.
+template <typename Variant>
+NodeCount perft(Board<Variant>& b, Short depth) {
+    if (depth == 0) {
+        return 1;
+    }
+    typename Board<Variant>::VariantMoveList moves{};
+    b.findLegalMoves(moves, b.mover());
+    if (depth == 1) {
+        return moves.size();
+    }
+    NodeCount result = 0;
+    typename Board<Variant>::UndoInfo undo;
+    for (const Move& move : moves) {
+        b.makeMove(move, undo);
+        result += perft(b, depth - 1);
+        b.unmakeMove(move, undo);
+    }
+    return result;
+}
+
+/// \brief Returns the perft count below each legal move of \p b, for a tree of depth \p depth,
+///        so that a count differing from a reference can be traced to the move responsible.
+template <typename Variant>
+std::vector<std::pair<Move, NodeCount>> divide(Board<Variant>& b, Short depth) {
+    std::vector<std::pair<Move, NodeCount>> result{};
+    typename Board<Variant>::VariantMoveList moves{};
+    b.findLegalMoves(moves, b.mover());
+    typename Board<Variant>::UndoInfo undo;
+    for (const Move& move : moves) {
+        b.makeMove(move, undo);
+        result.emplace_back(move, depth <= 1 ? 1 : perft(b, depth - 1));
+        b.unmakeMove(move, undo);
+    }
+    return result;
+}
+
+/// \brief A table of perft subtree counts, keyed by Zobrist hash and depth, that can be
+///        shared by threads without locks.
+///
+/// Each entry is a pair of 64-bit atomics: the data (count and depth), and the key XORed
+/// with the data. A reader accepts an entry only if the two agree with the key, so an entry
+/// torn by concurrent writers is treated as a miss rather than returning a wrong count.
+/// On a collision, the newer entry replaces the older one.
+class PerftHashTable {
+public:
+    /// \brief Constructs a table of about \p sizeMb megabytes (rounded down to a power of 2 entries).
+    explicit PerftHashTable(Size sizeMb);
+
+    std::optional<NodeCount> find(ZHash key, Short depth) const;
+    void store(ZHash key, Short depth, NodeCount count);
+
+    Size size() const { return _entries.size(); }
+
+private:
+    static constexpr Short DEPTH_BITS = 8;
+    static constexpr std::uint64_t DEPTH_MASK = (std::uint64_t{1} << DEPTH_BITS) - 1;
+
+    struct Entry {
+        std::atomic<std::uint64_t> check{0};  ///< \brief Key XOR data
+        std::atomic<std::uint64_t> data{0};   ///< \brief Count << DEPTH_BITS | depth; 0 if empty
+    };
+
+    Entry& _entry(ZHash key) { return _entries[key & (_entries.size() - 1)]; }
+    const Entry& _entry(ZHash key) const { return _entries[key & (_entries.size() - 1)]; }
+
+    std::vector<Entry> _entries;
+};
+
+/// \brief Like perft, but looks up and records the counts of subtrees of depth 2 or more
+///        in \p table, so that each transposition is only counted once.
+template <typename Variant>
+NodeCount perft(Board<Variant>& b, Short depth, PerftHashTable& table) {
+    if (depth <= 1) {
+        return perft(b, depth);
+    }
+    if (std::optional<NodeCount> optCount = table.find(b.zobristHash(), depth)) {
+        return optCount.value();
+    }
+    typename Board<Variant>::VariantMoveList moves{};
+    b.findLegalMoves(moves, b.mover());
+    NodeCount result = 0;
+    typename Board<Variant>::UndoInfo undo;
+    for (const Move& move : moves) {
+        b.makeMove(move, undo);
+        result += perft(b, depth - 1, table);
+        b.unmakeMove(move, undo);
+    }
+    table.store(b.zobristHash(), depth, result);
+    return result;
+}
+
+/// \brief Returns the same count as perft, computed by \p threadCount threads.
+///
+/// The move sequences of length \p splitDepth (1 or 2) from \p b are the work items, which
+/// idle threads take one at a time. Each thread searches on its own Board, built from a copy
+/// of \p b's Position. If \p optTable is given, all threads share it.
+/// Splitting at depth 2 gives more, smaller work items, which balance better across threads.
+template <typename Variant>
+NodeCount perftParallel(Board<Variant>& b, Short depth, Short threadCount,
+                        PerftHashTable* optTable=nullptr, Short splitDepth=1)
+{
+    splitDepth = std::clamp<Short>(splitDepth, 1, 2);
+    if (depth <= splitDepth || threadCount <= 1) {
+        return optTable ? perft(b, depth, *optTable) : perft(b, depth);
+    }
+
+    // ========== Work items: Move sequences of length splitDepth ==========
+    std::vector<std::vector<Move>> workItems{};
+    typename Board<Variant>::VariantMoveList moves{};
+    b.findLegalMoves(moves, b.mover());
+    typename Board<Variant>::UndoInfo undo;
+    for (const Move& move : moves) {
+        if (splitDepth == 1) {
+            workItems.push_back({move});
+            continue;
+        }
+        b.makeMove(move, undo);
+        typename Board<Variant>::VariantMoveList replies{};
+        b.findLegalMoves(replies, b.mover());
+        for (const Move& reply : replies) {
+            workItems.push_back({move, reply});
+        }
+        b.unmakeMove(move, undo);
+    }
+
+    // ========== Workers ==========
+    const Position<Variant> rootPosition = b.position();
+    std::atomic<Size> nextItem{0};
+    std::atomic<NodeCount> total{0};
+    auto work = [&]() {
+        Board<Variant> wb{"perft_worker", rootPosition};
+        NodeCount subtotal = 0;
+        for (Size k = nextItem++; k < workItems.size(); k = nextItem++) {
+            for (const Move& move : workItems[k]) {
+                wb.makeMove(move);
+            }
+            const Short remaining = depth - static_cast<Short>(workItems[k].size());
+            subtotal += optTable ? perft(wb, remaining, *optTable) : perft(wb, remaining);
+            wb.setPosition(rootPosition);
+        }
+        total += subtotal;
+    };
+    std::vector<std::thread> threads{};
+    for (Short t = 1; t < threadCount; ++t) {
+        threads.emplace_back(work);
+    }
+    work();  // This thread works, too.
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    return total;
+}
+
+/// \brief A perft count and how long it took.
+struct PerftResult {
+    NodeCount nodes;
+    double seconds;
+
+    double nodesPerSecond() const { return seconds > 0 ? nodes / seconds : 0.0; }
+};
+
+/// \brief Runs perft, timing it with a steady clock.
+template <typename Variant>
+PerftResult perftTimed(Board<Variant>& b, Short depth) {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    const NodeCount nodes = perft(b, depth);
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+    return PerftResult{nodes, elapsed.count()};
+}
+
+/// \brief Runs perftParallel, timing it with a steady clock.
+template <typename Variant>
+PerftResult perftParallelTimed(Board<Variant>& b, Short depth, Short threadCount,
+                               PerftHashTable* optTable=nullptr, Short splitDepth=1)
+{
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    const NodeCount nodes = perftParallel(b, depth, threadCount, optTable, splitDepth);
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+    return PerftResult{nodes, elapsed.count()};
+}
+
+/// \brief A position with known perft counts, used to check move generation.
+struct PerftReference {
+    std::string name;
+    std::string fen;
+    std::vector<NodeCount> counts;  ///< \brief counts[k] is the perft count at depth k + 1
+};
+
+/// \brief Perft counts for the Glinski initial position and for positions that exercise
+///        promotions, en passant, checks, and pins. Defined in perft.cpp.
+extern const std::vector<PerftReference> glinskiPerftReferences;
+
+}  // namespace hexchess::core
@@ -0,0 +1,61 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <type_traits>
+
+#include "util_hexchess.h"
+#include "variant.h"
+#include "zobrist.h"
+
+
+namespace hexchess::core {
+
+/// \brief The state of a game at one moment, without its history: where the pieces are,
+///        who is to move, the en passant cell, the counters, and the Zobrist hash.
+///
+/// A Position is trivially copyable, so it can be saved and restored with a memcpy
+/// (e.g., by copy-make game tree search), handed to another thread, or stored densely
+/// (e.g., for datasets). Board holds one, and adds the game history and caches.
+/// The fields are kept consistent with one another by Board; see Board::position.
+template <typename Variant>
+struct Position {
+    typedef Variant V;
+    using Bits = typename V::Bits;
+
+    // ========== Piece locations ==========
+    /// \brief Indexed directly by colorIndex(c) and pieceTypeIndex(pt).
+    Bits anyPieceBits;
+    Bits colorBits[V::COLOR_COUNT];
+    Bits pieceBits[V::COLOR_COUNT][V::PIECE_TYPE_COUNT];
+
+    Index kingIndex[V::COLOR_COUNT];
+
+    /// \brief The piece on each cell, in sync with the Bits above.
+    PieceCode mailbox[V::CELL_COUNT];
+
+    // ========== Non-piece data ==========
+    Color mover{Color::White};
+    OptIndex optEpIndex{std::nullopt};  ///< \brief Cell a Pawn skipped over on the previous move
+    Short nonProgressCounter{0};        ///< \brief Counter ticks since capture or Pawn move
+    HalfMoveCounter currentCounter{0};
+    ZHash zHash{0};                     ///< \brief Zobrist hash of the above, updated by XOR
+};
+
+static_assert(std::is_trivially_copyable_v<Position<Glinski>>,
+              "Position must be trivially copyable");
+
+}  // namespace hexchess::core
@@ -0,0 +1,78 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <stdexcept>
+#include <vector>
+
+#include "slider_attacks.h"
+#include "variant.h"
+
+
+namespace hexchess::core {
+
+extern template const SliderAttacks<Glinski>::Magics SliderAttacks<Glinski>::_magics;
+
+template<>
+SliderAttacks<Glinski>::LineEntries SliderAttacks<Glinski>::_makeEntries() {
+    LineEntries result{};
+    Size offset = 0;
+    for (Index from = 0; from < Glinski::CELL_COUNT; ++from) {
+        for (Short line = 0; line < LINE_COUNT; ++line) {
+            LineEntry& e = result[from][line];
+            e.mask = relevantMask(from, line);
+            e.magic = _magics[from][line];
+            e.loBitCount = std::popcount(e.mask.lo());
+            e.hiBitCount = std::popcount(e.mask.hi());
+            e.offset = offset;
+            offset += Size{1} << (e.loBitCount + e.hiBitCount);
+        }
+    }
+    return result;
+}
+
+template<>
+const SliderAttacks<Glinski>::LineEntries SliderAttacks<Glinski>::_entries = _makeEntries();
+
+// Fills in the attacks for every subset of each entry's relevant cells.
+// With magic indexing, a stale or hand-edited slider_magics.cpp is caught here.
+template<>
+std::vector<Glinski::Bits> SliderAttacks<Glinski>::_makeTable() {
+    const LineEntry& last = _entries[Glinski::CELL_COUNT - 1][LINE_COUNT - 1];
+    Size tableSize = last.offset + (Size{1} << (last.loBitCount + last.hiBitCount));
+    std::vector<Bits> result(tableSize);
+    std::vector<bool> isFilled(tableSize, false);
+    for (Index from = 0; from < Glinski::CELL_COUNT; ++from) {
+        for (Short line = 0; line < LINE_COUNT; ++line) {
+            const LineEntry& e = _entries[from][line];
+            Size subsetCount = Size{1} << (e.loBitCount + e.hiBitCount);
+            for (Size k = 0; k < subsetCount; ++k) {
+                Bits occupancy = maskSubset(e.mask, k);
+                Bits attacks = slowLineAttacks(from, line, occupancy);
+                Size pos = e.offset + _lineIndex(e, occupancy);
+                if (isFilled[pos] && result[pos] != attacks) {
+                    throw std::logic_error{"SliderAttacks: Invalid magic number in slider_magics.cpp"};
+                }
+                result[pos] = attacks;
+                isFilled[pos] = true;
+            }
+        }
+    }
+    return result;
+}
+
+template<>
+const std::vector<Glinski::Bits> SliderAttacks<Glinski>::_table = _makeTable();
+
+}  // namespace hexchess::core
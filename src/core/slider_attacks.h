@@ -0,0 +1,224 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+
+#include <array>
+#include <bit>
+#include <stdexcept>
+#include <vector>
+
+// The occupancy index is computed with BMI2's pext instruction when the compiler targets it
+// (e.g., with -mbmi2 or -march=native), and with per-lane magic multiplication otherwise.
+// Define HEXCHESS_NO_PEXT to force the magic multiplication (e.g., on CPUs with slow pext).
+#if defined(__BMI2__) && !defined(HEXCHESS_NO_PEXT)
+#include <immintrin.h>
+#define HEXCHESS_USE_PEXT 1
+#else
+#define HEXCHESS_USE_PEXT 0
+#endif
+
+#include "geometry.h"
+#include "util_hexchess.h"
+#include "variant.h"
+
+
+namespace hexchess::core {
+
+/// \brief Table lookup of the cells attacked by a Rook, Bishop, or Queen, given the board's occupancy.
+///
+/// Each cell lies on six lines: three orthogonal (Rook) and three diagonal (Bishop).
+/// For each cell and line, the occupancy of the line's "relevant" cells (those between the
+/// slider and the board edge, not counting the edge cell itself) is reduced to a small index
+/// (at most 9 bits on the Glinski board), which selects the precomputed attack Bits.
+/// A Rook's attacks are the union over its three orthogonal lines, and so on.
+///
+/// The index is either the pext of the occupancy in each 64-bit lane, or the (per-lane)
+/// product with a "magic" multiplier, keeping the top bits. The magic numbers are found by
+/// the slider_magics_gen tool, which writes slider_magics.cpp.
+template <typename Variant>
+class SliderAttacks {
+public:
+    typedef Variant V;
+    using Bits = typename V::Bits;
+    using Lane = typename Bits::Lane;
+
+    static constexpr Short LINE_COUNT = 6;        ///< \brief Lines through each cell
+    static constexpr Short ORTHO_LINE_COUNT = 3;  ///< \brief Lines [0, 3) are orthogonal, [3, 6) diagonal
+
+    /// \brief Multipliers used to index the occupancy of each lane, when pext is not used.
+    struct Magic {
+        Lane lo;
+        Lane hi;
+    };
+    using Magics = std::array<std::array<Magic, LINE_COUNT>, V::CELL_COUNT>;
+
+    // ========================================
+    // Lookup
+
+    /// \brief Returns the cells attacked along a single \p line through \p from, given \p occupancy.
+    ///        Lines [0, ORTHO_LINE_COUNT) are orthogonal; the rest are diagonal.
+    static const Bits& lineAttacks(Index from, Short line, const Bits& occupancy) {
+        const LineEntry& e = _entries[from][line];
+        return _table[e.offset + _lineIndex(e, occupancy)];
+    }
+
+    /// \brief Returns the cells attacked by a Rook at \p from, given \p occupancy.
+    static Bits rookAttacks(Index from, const Bits& occupancy) {
+        return lineAttacks(from, 0, occupancy)
+             | lineAttacks(from, 1, occupancy)
+             | lineAttacks(from, 2, occupancy);
+    }
+
+    /// \brief Returns the cells attacked by a Bishop at \p from, given \p occupancy.
+    static Bits bishopAttacks(Index from, const Bits& occupancy) {
+        return lineAttacks(from, 3, occupancy)
+             | lineAttacks(from, 4, occupancy)
+             | lineAttacks(from, 5, occupancy);
+    }
+
+    /// \brief Returns the cells attacked by a Queen at \p from, given \p occupancy.
+    static Bits queenAttacks(Index from, const Bits& occupancy) {
+        return rookAttacks(from, occupancy) | bishopAttacks(from, occupancy);
+    }
+
+    /// \brief Returns the cells attacked by a slider of PieceType \p pt at \p from, given \p occupancy.
+    static Bits attacks(PieceType pt, Index from, const Bits& occupancy) {
+        switch (pt) {
+        case PieceType::Queen:  return queenAttacks(from, occupancy);
+        case PieceType::Rook:   return rookAttacks(from, occupancy);
+        case PieceType::Bishop: return bishopAttacks(from, occupancy);
+        default:
+            throw std::logic_error{"SliderAttacks::attacks: Not a slider"};
+        }
+    }
+
+    /// \brief Returns "pext" or "magic": how occupancy is reduced to a table index in this build.
+    static constexpr const char* indexingMethod() { return HEXCHESS_USE_PEXT ? "pext" : "magic"; }
+
+    /// \brief Returns the magic multipliers (from slider_magics.cpp), indexed by [Index][line].
+    static const Magics& magics() { return _magics; }
+
+    // ========================================
+    // Table construction support (also used by slider_magics_gen and tests)
+
+    /// \brief Returns the pair of opposite directions (indices into BoardDir::steps) that form \p line.
+    static constexpr DirIndex lineDir(Short line, bool isReverse) {
+        DirIndex d = line < ORTHO_LINE_COUNT
+            ? BoardDir::ORTHO_DIR_BEGIN + line
+            : BoardDir::DIAG_DIR_BEGIN + (line - ORTHO_LINE_COUNT);
+        return isReverse ? d + 3 : d;
+    }
+
+    /// \brief Returns the cells on \p line through \p from whose occupancy can block a slide.
+    static Bits relevantMask(Index from, Short line) {
+        Bits result{};
+        for (bool isReverse : {false, true}) {
+            DirIndex d = lineDir(line, isReverse);
+            for (Index cur = V::neighbor(from, d);
+                 cur != V::OFF_BOARD && V::neighbor(cur, d) != V::OFF_BOARD;
+                 cur = V::neighbor(cur, d))
+            {
+                result.set(cur);
+            }
+        }
+        return result;
+    }
+
+    /// \brief Returns the cells attacked along \p line from \p from by walking the rays.
+    ///        This is the reference against which the tables are built.
+    static Bits slowLineAttacks(Index from, Short line, const Bits& occupancy) {
+        Bits result{};
+        for (bool isReverse : {false, true}) {
+            DirIndex d = lineDir(line, isReverse);
+            for (Index cur = V::neighbor(from, d); cur != V::OFF_BOARD; cur = V::neighbor(cur, d)) {
+                result.set(cur);
+                if (occupancy.test(cur)) {
+                    break;
+                }
+            }
+        }
+        return result;
+    }
+
+    /// \brief Returns the \p subsetIndex-th subset of \p mask, by depositing its bits into the mask.
+    static Bits maskSubset(const Bits& mask, Size subsetIndex) {
+        Bits result{};
+        Short k = 0;
+        for (Index index : mask) {
+            if ((subsetIndex >> k) & 1) {
+                result.set(index);
+            }
+            ++k;
+        }
+        return result;
+    }
+
+    /// \brief Returns the table index of a lane's occupancy \p laneOcc (already masked)
+    ///        for a lane with \p bitCount relevant bits, using multiplier \p magic.
+    static constexpr Size magicLaneIndex(Lane laneOcc, Lane magic, Short bitCount) {
+        return bitCount == 0 ? 0 : static_cast<Size>((laneOcc * magic) >> (64 - bitCount));
+    }
+
+    /// \brief Returns whether \p magic maps each subset of the lane mask \p laneMask
+    ///        to a distinct index.
+    static bool isValidMagicLane(Lane laneMask, Lane magic) {
+        Short bitCount = std::popcount(laneMask);
+        std::vector<bool> isUsed(Size{1} << bitCount, false);
+        Lane subset = 0;
+        do {  // Carry-Rippler enumeration of all subsets of laneMask
+            Size index = magicLaneIndex(subset, magic, bitCount);
+            if (isUsed[index]) {
+                return false;
+            }
+            isUsed[index] = true;
+            subset = (subset - laneMask) & laneMask;
+        } while (subset != 0);
+        return true;
+    }
+
+private:
+    /// \brief Where the attacks along one line from one cell are stored in _table.
+    struct LineEntry {
+        Bits mask;            ///< \brief Relevant cells
+        Magic magic;          ///< \brief Unused when HEXCHESS_USE_PEXT
+        Short loBitCount;     ///< \brief Relevant cells in the low lane
+        Short hiBitCount;     ///< \brief Relevant cells in the high lane
+        Size offset;          ///< \brief Position of this entry's first attack Bits in _table
+    };
+    using LineEntries = std::array<std::array<LineEntry, LINE_COUNT>, V::CELL_COUNT>;
+
+    static Size _lineIndex(const LineEntry& e, const Bits& occupancy) {
+#if HEXCHESS_USE_PEXT
+        return static_cast<Size>(_pext_u64(occupancy.lo(), e.mask.lo()))
+             | (static_cast<Size>(_pext_u64(occupancy.hi(), e.mask.hi())) << e.loBitCount);
+#else
+        return magicLaneIndex(occupancy.lo() & e.mask.lo(), e.magic.lo, e.loBitCount)
+             | (magicLaneIndex(occupancy.hi() & e.mask.hi(), e.magic.hi, e.hiBitCount) << e.loBitCount);
+#endif
+    }
+
+    static LineEntries _makeEntries();
+    static std::vector<Bits> _makeTable();
+
+    static const Magics _magics;        ///< \brief Defined in slider_magics.cpp (generated)
+    static const LineEntries _entries;
+    static const std::vector<Bits> _table;
+};
+
+}  // namespace hexchess::core
@@ -0,0 +1,758 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// This file was generated by src/tools/slider_magics_gen. Do not edit.
+
+#include "slider_attacks.h"
+#include "variant.h"
+
+
+namespace hexchess::core {
+
+/// Per-lane magic multipliers, indexed by [Index][line], for builds without pext.
+/// A lane with no relevant cells has multiplier zero.
+template<>
+const SliderAttacks<Glinski>::Magics SliderAttacks<Glinski>::_magics{{
+    {{  // 0
+        {0x084c204060010048, 0x2088954090000200},
+        {0x1041440100800200, 0x0000000000000000},
+        {0x4400000000002002, 0x0000000000000000},
+        {0x9095200402001104, 0x0000000000000000},
+        {0x00010110a2000c48, 0x81018800401000c1},
+        {0x0000000000000000, 0x0000000000000000},
+    }},
+    {{  // 1
+        {0x023014c004090065, 0x1004000000040002},
+        {0xa100224240608000, 0x0000000000000000},
+        {0x2400414000012091, 0x0000000000000000},
+        {0x4040084400040001, 0x0000000000000000},
+        {0x07014812c0090100, 0x0080180010040008},
+        {0x0000000000000000, 0x0000000000000000},
+    }},
+    {{  // 2
+        {0x00484c2004004043, 0x0820000202000410},
+        {0x000520800a200600, 0x0000000000000000},
+        {0x1800000084180212, 0x0000000000000000},
+        {0x0416102810411040, 0x0000000000000000},
+        {0x0000810008000180, 0x0050000c4800c405},
+        {0x4101000440022180, 0x0000000000000000},
+    }},
+    {{  // 3
+        {0x0014600182066041, 0x0000000000000000},
+        {0x9010040204480282, 0x0000000000000000},
+        {0x2800080c00840808, 0x0000000000000000},
+        {0x2410404050802200, 0x0000000000000000},
+        {0x0400400124404cc1, 0x2020002010004220},
+        {0x0452000000040000, 0x0000000000000000},
+    }},
+    {{  // 4
+        {0x8030368200202000, 0x0000000000000000},
+        {0x00100c0104005081, 0x0108000042700004},
+        {0x1040085000009000, 0x0000000000000000},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x200020104a008068, 0xa090112140000048},
+        {0x0011820080400400, 0x0000000000000000},
+    }},
+    {{  // 5
+        {0x90a1180901811000, 0x0000000000000000},
+        {0x0402082008006210, 0x4082400100100085},
+        {0x0880001000880820, 0x0000000000000000},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x50800c048241c1e0, 0x010c100ac0022108},
+        {0x002040402008286b, 0x0000000000000000},
+    }},
+    {{  // 6
+        {0x0002009008040040, 0x48100a0020000010},
+        {0x2681040104020900, 0x0000000000000000},
+        {0x0050000a00428043, 0x0000000000000000},
+        {0x040186100800d009, 0x0000000000000000},
+        {0x8008020001094009, 0x0000000000000000},
+        {0x0000000000000000, 0x0000000000000000},
+    }},
+    {{  // 7
+        {0x0200200831010080, 0x3004100208200508},
+        {0x0000826105a08020, 0x0000000000000000},
+        {0x1010008000000800, 0x0000000000000000},
+        {0x0410201404000204, 0x0000000000000000},
+        {0x000081404188a001, 0x0000000000000000},
+        {0x0000000000000000, 0x0000000000000000},
+    }},
+    {{  // 8
+        {0x0440c81a0c420020, 0x4a0800c000000000},
+        {0x0021102240200200, 0x0000000000000000},
+        {0x00305001200014c3, 0x0000000000000000},
+        {0x8882201000d00600, 0x0000000000000000},
+        {0x06008240408a4000, 0x8020002039020408},
+        {0x4082100206001011, 0x0000000000000000},
+    }},
+    {{  // 9
+        {0x9000400204002418, 0x5804008020000040},
+        {0x8110800404240089, 0x0000000000000000},
+        {0x0450020008280420, 0x0000000000000000},
+        {0x00002a2404442002, 0x0000000000000000},
+        {0x8c40004011034400, 0x508208a80000a202},
+        {0x8001015094400801, 0x0000000000000000},
+    }},
+    {{  // 10
+        {0x0000120cc6008102, 0x0000000000000000},
+        {0xa033020942060105, 0x0100081441000020},
+        {0x2442310800808000, 0x0000000000000000},
+        {0x144810000210019a, 0x0000000000000000},
+        {0x000000a240050800, 0x2000138001089804},
+        {0x20808442a0194091, 0x0000000000000000},
+    }},
+    {{  // 11
+        {0x00080488004020b0, 0x0000000000000000},
+        {0x0000601408004040, 0x90e0800000800000},
+        {0x102000800300a001, 0x0000000000000000},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x28b0211000408544, 0x1400110040500290},
+        {0x040224802a000004, 0x0000000000000000},
+    }},
+    {{  // 12
+        {0x0012040105004000, 0x0000000000000000},
+        {0x0400043002850112, 0x611880a9c0411204},
+        {0x4030000008004001, 0x0000000000000000},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x400000080000c482, 0x0901444000000840},
+        {0x9000b20850200842, 0x0000000000000000},
+    }},
+    {{  // 13
+        {0x0010011020024624, 0x50c2504042019008},
+        {0x00c0840101400100, 0x0000000000000000},
+        {0x8410410012000105, 0x0000000000000000},
+        {0x8002112410060018, 0x0000000000000000},
+        {0x00000004a4042800, 0x0000000000000000},
+        {0x2700008408008020, 0x0000000000000000},
+    }},
+    {{  // 14
+        {0x14000100a4021828, 0x4210090008000210},
+        {0x1100811048080024, 0x0000000000000000},
+        {0x0803080410008900, 0x0000000000000000},
+        {0x1002048484038c80, 0x0000000000000000},
+        {0x0000000140000440, 0x0700030203000105},
+        {0x0484820041080200, 0x0000000000000000},
+    }},
+    {{  // 15
+        {0x0090005120020820, 0x2318240000828080},
+        {0xc089804080100100, 0x0000000000000000},
+        {0x001e300004b00108, 0x0000000000000000},
+        {0x100000200e888009, 0x0000000000000000},
+        {0x0010310440000101, 0x60c9800580000080},
+        {0x0840214500420088, 0x0000000000000000},
+    }},
+    {{  // 16
+        {0x08a0086062020084, 0x0b88e000002a0028},
+        {0x00280404d0010401, 0x0000000000000000},
+        {0x2101040d04060080, 0x0000000000000000},
+        {0x0980082002240600, 0x0000000000000000},
+        {0x1200090810040128, 0x8043441008188804},
+        {0x0008130180c00000, 0x0000000000000000},
+    }},
+    {{  // 17
+        {0x0130c0b059090142, 0x4800000800000020},
+        {0x8004000208040061, 0x9100828000000022},
+        {0x4882820242000002, 0x0000000000000000},
+        {0x4240081020800020, 0x0000000000000000},
+        {0x0000010008000082, 0x0020810608001200},
+        {0x0811088262800108, 0x0000000000000000},
+    }},
+    {{  // 18
+        {0x0812220214004004, 0x0000000000000000},
+        {0x0001007004540060, 0x4080430086600001},
+        {0x0404410000042000, 0x0000000000000000},
+        {0x0040808401111b20, 0x0000000000000000},
+        {0x0800082208100028, 0x0114040321004020},
+        {0x0102022012218406, 0x0000000000000000},
+    }},
+    {{  // 19
+        {0xc258000202000882, 0x0000000000000000},
+        {0x180020100401c020, 0x9840408020002818},
+        {0x1080200200801800, 0x0000000000000000},
+        {0x4030000008440000, 0x0000000000000000},
+        {0x0090000002108020, 0xa0080001c0010701},
+        {0x0000132014040020, 0x0000000000000000},
+    }},
+    {{  // 20
+        {0x000400414102a002, 0x0000000000000000},
+        {0x0014204401102840, 0x8810400280342004},
+        {0xa080300430200000, 0x0000000000000000},
+        {0x601000910000000a, 0x0000000000000000},
+        {0x0040300001040011, 0x0000000000000000},
+        {0x0480808244280629, 0x0000000000000000},
+    }},
+    {{  // 21
+        {0x2102424170500d01, 0x0092620400000010},
+        {0x0082840200078808, 0x0000000000000000},
+        {0x0c00200808400400, 0x0000000000000000},
+        {0x00613024240c0082, 0x1800002000083230},
+        {0x0420018710400800, 0x0000000000000000},
+        {0x0442000100040000, 0x0000000000000000},
+    }},
+    {{  // 22
+        {0x4201410020104302, 0x2441220004002092},
+        {0x0080c22040440002, 0x0000000000000000},
+        {0x0400000808000022, 0x0000000000000000},
+        {0x0008400820411044, 0x0000000000000000},
+        {0x02d200208074224a, 0x0000000000000000},
+        {0x0061002860440000, 0x0000000000000000},
+    }},
+    {{  // 23
+        {0x56220404210200a0, 0x2408a00000028081},
+        {0x0020800080040cc0, 0x0000000000000000},
+        {0x1c00320401000180, 0x0000000000000000},
+        {0x8488018060950008, 0x0000000000000000},
+        {0x0000200004090081, 0x0000000000000000},
+        {0x0010988140001080, 0x0000000000000000},
+    }},
+    {{  // 24
+        {0x0100310810010251, 0x230a0c4022000408},
+        {0x0004200002100481, 0x0000000000000000},
+        {0x0080090201000500, 0x0000000000000000},
+        {0x0200820010448240, 0x0000000000000000},
+        {0x00801000304c0210, 0x8882800422041100},
+        {0x3441a09880400000, 0x0000000000000000},
+    }},
+    {{  // 25
+        {0x00582110420200a1, 0x1204280888002000},
+        {0x003002c002010081, 0x0140001500028000},
+        {0x0081c24800000540, 0x0000000000000000},
+        {0x8141428008424008, 0x0000000000000000},
+        {0x1160560a03448000, 0x5a040001a1028206},
+        {0x0000080240115060, 0x0000000000000000},
+    }},
+    {{  // 26
+        {0x20092000c2023920, 0xca090c0000502002},
+        {0x0010780022022110, 0x2580814220810400},
+        {0x00000288004410e4, 0x0000000000000000},
+        {0x4050400204000214, 0x0000000000000000},
+        {0x000090a408430000, 0x2130000144800040},
+        {0x4010000022080600, 0x0000000000000000},
+    }},
+    {{  // 27
+        {0x11c248020a048402, 0x0000000000000000},
+        {0x0020040444020010, 0x1020880012850084},
+        {0x0000110803000080, 0x0000000000000000},
+        {0x8040404001800000, 0x0000000000000000},
+        {0x0200820200010002, 0x10808005b0040001},
+        {0x0a04880216040c00, 0x0000000000000000},
+    }},
+    {{  // 28
+        {0x0008103000b03803, 0x0000000000000000},
+        {0x0050800403018040, 0x50201080481d2a04},
+        {0x0010028200000208, 0x0000000000000000},
+        {0x8232200010088440, 0x0000000000000000},
+        {0x0042044801108804, 0x080204481010a000},
+        {0x40420000286a0080, 0x0000000000000000},
+    }},
+    {{  // 29
+        {0x0402c85122800020, 0x0000000000000000},
+        {0x8800018041402060, 0x9004300000808000},
+        {0x0200310800004000, 0x0000000000000000},
+        {0x0020080001800008, 0x0000000000000000},
+        {0x0000022090084000, 0x0000000000000000},
+        {0x4040081031030021, 0x0000000000000000},
+    }},
+    {{  // 30
+        {0x0210080080200262, 0x294480a080011000},
+        {0x0109940b00212000, 0x0000000000000000},
+        {0x0000004402001004, 0x0000000000000000},
+        {0x0002000040d04200, 0x400b00c020001002},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x804193a2a4040002, 0x0000000000000000},
+    }},
+    {{  // 31
+        {0x1209400240360109, 0x184082a000084180},
+        {0x1100810000080080, 0x0000000000000000},
+        {0x1080002102032000, 0x0000000000000000},
+        {0x8180114881101880, 0x242460a0a0a10680},
+        {0x00800410000c4804, 0x0000000000000000},
+        {0x2a12310010042010, 0x0000000000000000},
+    }},
+    {{  // 32
+        {0x002c1200008820e0, 0x8112648801490082},
+        {0x0180248044084882, 0x0000000000000000},
+        {0x1a41020006002018, 0x0000000000000000},
+        {0x0008029008180c40, 0x900080c000002100},
+        {0x8092200002318300, 0x0100004650000004},
+        {0x1008208b004a0041, 0x0000000000000000},
+    }},
+    {{  // 33
+        {0x400126c000490108, 0x20a1c80000105000},
+        {0x0040a05020108441, 0x0000000000000000},
+        {0x100280020a000800, 0x0000000000000000},
+        {0x01804009040a2840, 0x0000000000000000},
+        {0x1000802404020210, 0x0080981344bc0009},
+        {0x0400094108100108, 0x0000000000000000},
+    }},
+    {{  // 34
+        {0x5040604008605480, 0x6004080120a60002},
+        {0x0210020440222041, 0x09800801000e0012},
+        {0x8340021012008008, 0x0000000000000000},
+        {0x8000005288020030, 0x0000000000000000},
+        {0x5020400111102100, 0x2040000000101080},
+        {0x000000a002088001, 0x0000000000000000},
+    }},
+    {{  // 35
+        {0x918140100000c024, 0x0c08083a80200040},
+        {0x0084102000008098, 0x4421013044000208},
+        {0x0140040420214026, 0x0000000000000000},
+        {0x02040140c0010804, 0x0000000000000000},
+        {0x7403400000010050, 0x0020002110000404},
+        {0x04e0231001850151, 0x0000000000000000},
+    }},
+    {{  // 36
+        {0x101060210000600e, 0x0c10000000010000},
+        {0x4400040802204081, 0x11a0940418c01284},
+        {0x0000002042000c14, 0x0000000000000000},
+        {0x0841402013008000, 0x0000000000000000},
+        {0x4000900100000058, 0x4010a04800016000},
+        {0x00908001000a0200, 0x0000000000000000},
+    }},
+    {{  // 37
+        {0x0402081828205010, 0x0000000000000000},
+        {0x80008a0808008150, 0x1810409028000011},
+        {0x4100104108088002, 0x0000000000000000},
+        {0x0441883820002420, 0x0000000000000000},
+        {0x0002080002002820, 0x4148000000802000},
+        {0x0801008088212041, 0x0000000000000000},
+    }},
+    {{  // 38
+        {0x000210220400a000, 0x0000000000000000},
+        {0x0200808008a08034, 0x0511100000401014},
+        {0xe000446024001001, 0x0000000000000000},
+        {0x5181900800208400, 0x0000000000000000},
+        {0x3800010118000090, 0x0000000000000000},
+        {0x00500000000080a0, 0xa810800000030003},
+    }},
+    {{  // 39
+        {0x2002340440108400, 0x0000000000000000},
+        {0x06a4050204902013, 0x084c840020204020},
+        {0x000042400200c810, 0x0000000000000000},
+        {0x4c400a0401020500, 0x0000000000000000},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x0060200050048020, 0x424100a022a00808},
+    }},
+    {{  // 40
+        {0x0000050a10040d04, 0x8281002400800118},
+        {0x0a02950108402004, 0x0000000000000000},
+        {0x4000025000514005, 0x0000000000000000},
+        {0x0000100020010401, 0x004011a000104060},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x2010802040000080, 0x0000000000000000},
+    }},
+    {{  // 41
+        {0x4000040100200809, 0x00a1000208000040},
+        {0x6302804090c62420, 0x0000000000000000},
+        {0x80402a0802010100, 0x0000000000000000},
+        {0x0000810000108500, 0x602010008012c000},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x08e044a0c803c2aa, 0x0000000000000000},
+    }},
+    {{  // 42
+        {0x0004004848820601, 0x2840804008006000},
+        {0x08688220800c0200, 0x0000000000000000},
+        {0x24100084c210c000, 0x0000000000000000},
+        {0x0410985002064200, 0x2493000000c80040},
+        {0x0100220280040001, 0x0000000000000000},
+        {0x0080202235000000, 0x0000000000000000},
+    }},
+    {{  // 43
+        {0x2020120040020082, 0x3042200004000260},
+        {0x0210110820300422, 0x0000000000000000},
+        {0x0050004042234008, 0x0000000000000000},
+        {0x0080020004008130, 0x301b801800200008},
+        {0x00810a8100020005, 0x0000000000000000},
+        {0x088810122a000540, 0x0000000000000000},
+    }},
+    {{  // 44
+        {0x1831013040620040, 0x28ca200040118820},
+        {0xd0100604081018c9, 0x0100002105400010},
+        {0x8002024000500814, 0x0000000000000000},
+        {0xa012000082210040, 0x1000020000080000},
+        {0x8224108004000010, 0x8c01108000001010},
+        {0x0000449084000600, 0x0000000000000000},
+    }},
+    {{  // 45
+        {0x0241505020218a40, 0x610c082080020010},
+        {0x1210240684100080, 0x80a0860081000810},
+        {0x0000400040080406, 0x0000000000000000},
+        {0x0800000845100060, 0x0000000000000000},
+        {0x0202804020002010, 0x4020000a0048c110},
+        {0x2000000028400100, 0x0000000000000000},
+    }},
+    {{  // 46
+        {0x0088200808000040, 0x100480c380240000},
+        {0x4c00181001028024, 0x1041400415000000},
+        {0x0220808448040200, 0x0000000000000000},
+        {0x288280566212c192, 0x0000000000000000},
+        {0x4040002002002201, 0x2204842000204003},
+        {0x0201e82802088061, 0x0000000000000000},
+    }},
+    {{  // 47
+        {0x0040731008800014, 0x0881840420020000},
+        {0x01400004010a0040, 0x0c10400000402000},
+        {0x880ca02010020112, 0x0000000000000000},
+        {0x2100426010100120, 0x0000000000000000},
+        {0x08000010200040c0, 0x1800089000411000},
+        {0x2440001011008984, 0x8000080112000a08},
+    }},
+    {{  // 48
+        {0x0008200801c04002, 0x0000000000000000},
+        {0x0280830241010020, 0x100490008003a100},
+        {0x1c80208402010081, 0x0000000000000000},
+        {0x2101801008200418, 0x0000000000000000},
+        {0x7030300e02000001, 0x280008000500980c},
+        {0xc000000500080058, 0x7280808002010000},
+    }},
+    {{  // 49
+        {0x000204a402001001, 0x0000000000000000},
+        {0x0040084984020090, 0x0608082612800800},
+        {0x1018000090008004, 0x0000000000000000},
+        {0x4001402001000000, 0x0000000000000000},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x04008000000a3172, 0x2020040042000006},
+    }},
+    {{  // 50
+        {0x0001020611001002, 0x0000000000000000},
+        {0x0001401800004228, 0x06210851a4000400},
+        {0x220404000aa24000, 0x0000000000000000},
+        {0x0420489001014805, 0x0000000000000000},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x0431004400002454, 0x282421c200004800},
+    }},
+    {{  // 51
+        {0x0080260084800006, 0x4902081850260000},
+        {0x0815008500082000, 0x0000000000000000},
+        {0x1020181100080501, 0x0000000000000000},
+        {0x0002488009200002, 0x8444c20000064000},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x1800101008200400, 0x0000000000000000},
+    }},
+    {{  // 52
+        {0x010062b024406081, 0x0881002000000020},
+        {0x44090080a0241010, 0x0000000000000000},
+        {0x4618408020248070, 0x0000000000000000},
+        {0x0082002204909023, 0x1440501000040a00},
+        {0x1401008300400208, 0x0000000000000000},
+        {0x4090581060274290, 0x0000000000000000},
+    }},
+    {{  // 53
+        {0x1011a0824211c045, 0x0080410200022a00},
+        {0x010820684040a409, 0x0000000000000000},
+        {0x0e01281000200030, 0x0000000000000000},
+        {0x0000000000000000, 0x8096102008000200},
+        {0x0031202080401200, 0x1144125000202400},
+        {0x3040114904081416, 0x0000000000000000},
+    }},
+    {{  // 54
+        {0x0c04160040640010, 0xc212400000002008},
+        {0xc010021002130101, 0x811a041202040220},
+        {0x3200840200000150, 0x0000000000000000},
+        {0x00082003d0202c10, 0x4388020004085044},
+        {0x0000801440c94880, 0x00800060c001a080},
+        {0x1800000159162000, 0x0000000000000000},
+    }},
+    {{  // 55
+        {0x0006008048028010, 0x4090880400002004},
+        {0x0048042034014200, 0xc080490020110241},
+        {0x1050100021400090, 0x0000000000000000},
+        {0x2008004091100400, 0x6410020820023000},
+        {0x408040012c700100, 0x0040000010000014},
+        {0x0400004001410029, 0x0000000000000000},
+    }},
+    {{  // 56
+        {0x0090808005430001, 0x0b88900400100020},
+        {0x0048101202030048, 0x621c80100a000008},
+        {0x0421111040003110, 0x0000000000000000},
+        {0x0044009080258000, 0x3010000088400021},
+        {0x0004e00010000080, 0x0030120020000000},
+        {0x0b410041006b0000, 0x8110100600000108},
+    }},
+    {{  // 57
+        {0x2921400801060000, 0xa888000040091a01},
+        {0x4080000409010001, 0x1148c00100000110},
+        {0x0408288000024210, 0x0000000000000000},
+        {0x0200c01448020a98, 0x0000000000000000},
+        {0x21c0100c08000014, 0x1012188201418000},
+        {0x0000000200018110, 0x3080001400840201},
+    }},
+    {{  // 58
+        {0x000c206011304000, 0x0910005040030088},
+        {0x4890484001108000, 0x2408240800806100},
+        {0x4104804010000410, 0x0000000000000000},
+        {0x0020008324008800, 0x0000000000000000},
+        {0x08025a0204080050, 0x0008001008058040},
+        {0x0000000000000000, 0x104021001000083a},
+    }},
+    {{  // 59
+        {0x0010080104043002, 0x0000000000000000},
+        {0x480820006308401c, 0x08046f0008800000},
+        {0x2000008a0a006420, 0x0000000000000000},
+        {0x4000005014010600, 0x0000000000000000},
+        {0x00084a0123308260, 0x0000000000000000},
+        {0x0000000000000000, 0x0820308200010348},
+    }},
+    {{  // 60
+        {0x0301900210452020, 0x0000000000000000},
+        {0x0000000000000000, 0x01448c0000000002},
+        {0x08000180a004aa10, 0x0000000000000000},
+        {0x008102a001012002, 0x0000000000000000},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x0000000000000000, 0x2808102c00206802},
+    }},
+    {{  // 61
+        {0x0480040840001008, 0x0255200020640008},
+        {0x8448090040081130, 0x0000000000000000},
+        {0x8042000019404001, 0x6800080200180011},
+        {0x0000000000000000, 0x0488800040000810},
+        {0x0008800008402008, 0x0000000000000000},
+        {0x00001008040b0411, 0x0000000000000000},
+    }},
+    {{  // 62
+        {0x0204a11400400680, 0x0101900080001008},
+        {0x5040c01044841120, 0x0000000000000000},
+        {0x8040800400422001, 0x420440c000100102},
+        {0x0000000000000000, 0x0043402118280400},
+        {0x2b00018400200002, 0x0000000000000000},
+        {0x8400a00102220200, 0x0000000000000000},
+    }},
+    {{  // 63
+        {0x0420000540a30220, 0x2084400008220000},
+        {0x310110401000a240, 0x11108011001b0210},
+        {0x004a800400004006, 0x080040a405c00020},
+        {0x5000000b8a105880, 0x0040103400115180},
+        {0x0000109400900008, 0x0000000000000000},
+        {0x2124100001020090, 0x0000000000000000},
+    }},
+    {{  // 64
+        {0x201002021184c108, 0x0024400002080000},
+        {0x00080a2404040409, 0x0084828000800000},
+        {0x0020300000900101, 0x0801001008200800},
+        {0x00a0008440007400, 0x0930600000088000},
+        {0x0003604146080408, 0x0000000000000000},
+        {0x0400001000108080, 0x0000000000000000},
+    }},
+    {{  // 65
+        {0x4008a42c40420080, 0x0050680048402000},
+        {0x3580020418010008, 0x0240500000128000},
+        {0x00004d0020200081, 0x1838301000050408},
+        {0x8000040040200100, 0x2212042051000088},
+        {0x2820802081240081, 0x0000000000000000},
+        {0x8101100000048020, 0x00d3000080003000},
+    }},
+    {{  // 66
+        {0x4020816020104074, 0x400c100000600801},
+        {0x1800040881088009, 0x0123a20090000010},
+        {0x28104000804a0803, 0x4202112000210000},
+        {0x9004040028080500, 0x0000000000000000},
+        {0x10040d2801010440, 0x0000000000000000},
+        {0x0800002480001864, 0x02d9004000800800},
+    }},
+    {{  // 67
+        {0x0080200486045020, 0x0008008020010822},
+        {0x1060050182002013, 0x0110100888200200},
+        {0x0000002200080041, 0x2102080509000000},
+        {0x04000000802c2030, 0x0000000000000000},
+        {0x4200001210048688, 0x0000000000000000},
+        {0x0040022021800010, 0x802440800001200a},
+    }},
+    {{  // 68
+        {0x0048602052401018, 0x0000000000000000},
+        {0x0080322440024018, 0x0008882001801611},
+        {0x0804000000002101, 0x5002002650024000},
+        {0x02004008e0040110, 0x0000000000000000},
+        {0x0000008803806204, 0x0000000000000000},
+        {0x0000000000000000, 0x2010600a11141800},
+    }},
+    {{  // 69
+        {0x2060210402000882, 0x0000000000000000},
+        {0x000cc00008104008, 0x6a02884100428080},
+        {0x0280000244100401, 0x0800000000000000},
+        {0x0000824204320030, 0x0000000000000000},
+        {0x9000000000204010, 0x0000000000000000},
+        {0x0000000000000000, 0x0104200000101410},
+    }},
+    {{  // 70
+        {0x840100000000100a, 0x0003180001900800},
+        {0x0a11182042080882, 0x0000000000000000},
+        {0x0000000000000000, 0x4008040004c01080},
+        {0x0000000000000000, 0x4005840104201000},
+        {0x402c10008b028842, 0x0000000000000000},
+        {0x081000404a008125, 0x0000000000000000},
+    }},
+    {{  // 71
+        {0x0008048000700809, 0x4003000000004004},
+        {0x6c01283046828101, 0x0000000000000000},
+        {0x0000000000000000, 0x0021080000740080},
+        {0x0000000000000000, 0x40108208000000c0},
+        {0x0010805840000401, 0x0000000000000000},
+        {0x0000160b04232040, 0x801800010020140c},
+    }},
+    {{  // 72
+        {0x421009002008020d, 0x8a48810830000600},
+        {0x4204061030202420, 0x8008800000061014},
+        {0x0000000000000000, 0x1104000484804000},
+        {0x0000040010000002, 0x0080400c20002010},
+        {0x000118c030008120, 0x0000000000000000},
+        {0x0200009402019830, 0xc200020030000200},
+    }},
+    {{  // 73
+        {0xe0000104801401e0, 0x4020401080001001},
+        {0x68100c0201850084, 0x4400500080000000},
+        {0x0000000000000000, 0x00820100020c0300},
+        {0x04c8081000321411, 0x000022a060a00000},
+        {0x2004c14008400308, 0x0000000000000000},
+        {0x01004020002d00a0, 0x2020020000000120},
+    }},
+    {{  // 74
+        {0x1025218041421020, 0x5a091000400c0044},
+        {0x0820000242010808, 0x2202200010000002},
+        {0x0000000000000000, 0x004802400e000420},
+        {0x0004080080460400, 0x8680c1400018020a},
+        {0x0200204090200628, 0x0000000000000000},
+        {0x0001028200a40214, 0xa920842002000104},
+    }},
+    {{  // 75
+        {0x1900084208484010, 0x2844880020022400},
+        {0x0011000040d88030, 0x3001100000200000},
+        {0x0000000000000000, 0x0020880500040848},
+        {0x1002100800284114, 0x5201200400486021},
+        {0x221009a028002128, 0x0000000000000000},
+        {0x0000000000000000, 0x0800208040010004},
+    }},
+    {{  // 76
+        {0x7880a01881110426, 0x3000180015000202},
+        {0x008000000a032010, 0x040090018e000440},
+        {0x0000000000000000, 0x0210000800120000},
+        {0x0800000229900080, 0x6040000041201090},
+        {0x0000080844844248, 0x0000000000000000},
+        {0x0000000000000000, 0x0404204800000010},
+    }},
+    {{  // 77
+        {0x0290202000c83004, 0x890404800a100100},
+        {0x04e0002400a00819, 0x023008000802018c},
+        {0x0000000000000000, 0x0008018000210000},
+        {0x0000000020084048, 0x1000030200803000},
+        {0x1804008022480108, 0x0000000000000000},
+        {0x0000000000000000, 0x0021100492000020},
+    }},
+    {{  // 78
+        {0x0000200c00111023, 0x0240000088002450},
+        {0x0402112004060011, 0x1100000200030000},
+        {0x0000000000000000, 0x8004100600040829},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x4019110048580082, 0x0000000000000000},
+        {0x2806420410004044, 0x3280402000021200},
+    }},
+    {{  // 79
+        {0x0100000c82200602, 0x4100040088613c40},
+        {0x2006220110020441, 0x4c8000a100420020},
+        {0x0000000000000000, 0x0003100101001042},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x040004400008c011, 0x0000000000000000},
+        {0x0400001120002021, 0x2420844002041182},
+    }},
+    {{  // 80
+        {0x0019006630104109, 0x0080060040004100},
+        {0x040c011268088242, 0x4072600610850c02},
+        {0x0000000000000000, 0x0601080a00104800},
+        {0x0000000000000000, 0x8950000001802000},
+        {0x0800004600084010, 0x8340886000000800},
+        {0x080008020c100012, 0x301c020000010c00},
+    }},
+    {{  // 81
+        {0x0200031020121200, 0x802024a040008182},
+        {0x4220000121110220, 0x1120008045400010},
+        {0x0000000000000000, 0x0002508002008800},
+        {0x0000000010521e12, 0x40a4802528004241},
+        {0x1000046c0144008c, 0x400b010004000a00},
+        {0x0000000000000000, 0x0410040124008102},
+    }},
+    {{  // 82
+        {0x4000224020c81020, 0x4010080001100004},
+        {0x0202124002024019, 0x1008808004482880},
+        {0x0000000000000000, 0x1080422410100000},
+        {0x820800c128802401, 0x2140610200000402},
+        {0x0200151402024c16, 0x7220100028400020},
+        {0x0000000000000000, 0x8008818203040420},
+    }},
+    {{  // 83
+        {0x8020418001160018, 0x1110200234412400},
+        {0x00020d800b042010, 0x0805920008001028},
+        {0x0000000000000000, 0x0001200040040041},
+        {0x0204480400801408, 0x8070000074008010},
+        {0x0200508801110250, 0x100208a001000400},
+        {0x0000000000000000, 0x0000000000000000},
+    }},
+    {{  // 84
+        {0x402c602010002958, 0x0808080110141000},
+        {0x401401a48000021a, 0x2416024001011050},
+        {0x0000000000000000, 0x4400100002002000},
+        {0x8090a00010101240, 0x2810103000248208},
+        {0x0040010500288001, 0x0c00000800010848},
+        {0x0000000000000000, 0x0000000000000000},
+    }},
+    {{  // 85
+        {0x0000000840000824, 0x02018a0804020040},
+        {0x0490100451022940, 0x6181880031200010},
+        {0x0000000000000000, 0x0a4001c020000810},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x04a20110c02c0100, 0x010900090c100000},
+        {0x04041a1000080012, 0x2c10800041c20a02},
+    }},
+    {{  // 86
+        {0x8000c0c088122502, 0x0908c43021003110},
+        {0x4480022102610080, 0x48a4220000002008},
+        {0x0000000000000000, 0x030010c200201001},
+        {0x0000000000000000, 0x0000000000000000},
+        {0x18011a0214200108, 0x0080040418022101},
+        {0x0000000000000000, 0xa210a00100023000},
+    }},
+    {{  // 87
+        {0xc1000008a2120101, 0x864086120010880a},
+        {0x0102000400824a40, 0x9620502001804004},
+        {0x0000000000000000, 0x861800c020880730},
+        {0x0000000000000000, 0x6007002802002009},
+        {0x0009200032000100, 0x0cd0004200000000},
+        {0x0000000000000000, 0x0016200420504001},
+    }},
+    {{  // 88
+        {0x0900030010101080, 0x4dc090000c440008},
+        {0x0108066001888410, 0x108690804a140002},
+        {0x0000000000000000, 0x28001144000082c0},
+        {0x0000000000000000, 0x2108400000005040},
+        {0x4110180408800080, 0x1160840004903848},
+        {0x0000000000000000, 0x0400500510002000},
+    }},
+    {{  // 89
+        {0x40010a4008080c34, 0x5020120000700000},
+        {0x4248062002042414, 0x024809a600000425},
+        {0x0000000000000000, 0x0000008800000512},
+        {0x090441e402001003, 0x0080206280080042},
+        {0x6888080115008140, 0x20100c0208400200},
+        {0x0000000000000000, 0x0000000000000000},
+    }},
+    {{  // 90
+        {0x1420a95810a10080, 0x1106111000008008},
+        {0x262100180000008c, 0x2c01240040000008},
+        {0x0000000000000000, 0x00008540000400a0},
+        {0x0004212000200641, 0x0020204050184080},
+        {0x80025030420ac00a, 0x0019001400240004},
+        {0x0000000000000000, 0x0000000000000000},
+    }},
+}};
+
+}  // namespace hexchess::core
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <math.h>
+#include <cstdint>
 
 #include <array>
 #include <bitset>
@@ -72,6 +73,9 @@ using HexCoord = Short;
 /// a capture or Pawn move is called nonProgressCounters.
 using HalfMoveCounter = Short;
 
+/// \brief A count of game tree nodes (e.g., leaves counted by perft, or positions searched).
+using NodeCount = std::uint64_t;
+
 using Score = double;  // For game scores, including 0.5-0.5
 
 using Strings = std::vector<std::string>;
@@ -147,6 +151,9 @@ Q_ENUM_NS(Color)
 
 using OptColor = std::optional<Color>;
 
+/// \brief The position of Color \p c in per-Color arrays (e.g., Board's piece bits).
+constexpr Short colorIndex(Color c) { return static_cast<Short>(c); }
+
 inline Color opponent(Color c) { return c == Color::Black ? Color::White : Color::Black; }
 inline Color nextPlayer(Color c) { return opponent(c); }
 inline Color prevPlayer(Color c) { return opponent(c); }
@@ -181,6 +188,25 @@ constexpr PieceType pieceTypes[6] {
     PieceType::Pawn
 };
 using PieceTypes = std::vector<PieceType>;  // For listing available promotion types
+
+/// \brief The position of PieceType \p pt in per-PieceType arrays (e.g., Board's piece bits).
+constexpr Short pieceTypeIndex(PieceType pt) { return static_cast<Short>(pt); }
+
+/// \brief A piece's Color and PieceType packed into one byte, for Board's per-cell mailbox.
+///
+/// The low three bits hold pieceTypeIndex(pt) + 1, and the next bit holds colorIndex(c),
+/// so that the value zero (noPieceCode) means that the cell is empty.
+using PieceCode = std::uint8_t;
+constexpr PieceCode noPieceCode{0};
+
+constexpr PieceCode pieceCode(Color c, PieceType pt) {
+    return static_cast<PieceCode>((colorIndex(c) << 3) | (pieceTypeIndex(pt) + 1));
+}
+constexpr Color pieceCodeColor(PieceCode code) { return static_cast<Color>(code >> 3); }
+constexpr PieceType pieceCodePieceType(PieceCode code) {
+    return static_cast<PieceType>((code & 0x7) - 1);
+}
+
 PieceType piece_type_parse(char ch);
 const std::string piece_type_string(PieceType pt);
 inline std::ostream& operator<<(std::ostream& os, PieceType pt) {
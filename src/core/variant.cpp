@@ -13,8 +13,11 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <cassert>
+
 #include <iostream>
 #include <map>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -31,67 +34,13 @@ using std::vector;
 
 namespace hexchess::core {
 
-template<>
-HexRay<Glinski>::HexRay(Index start, const HexDir& dir)
-    : _start{start}, _dir{dir}, _indices{}
-{
-    for (HexPos cursor = V::indexToPos(start) + dir;
-             V::isOnBoard(cursor);
-             cursor += dir)
-    {
-        Index curIndex = V::posToIndex(cursor);
-        _indices.push_back(curIndex);
-    }
-}
-
 // ========================================
 // Board coordinates
 
-HexCoord Glinski::hex0(Index index) {
-    static const std::vector<HexCoord> i2h0 {
-                      0,  1,  2,  3,  4,  5,
-                    0,  1,  2,  3,  4,  5,  6,
-                  0,  1,  2,  3,  4,  5,  6,  7,
-                0,  1,  2,  3,  4,  5,  6,  7,  8,
-              0,  1,  2,  3,  4,  5,  6,  7,  8,  9,
-            0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10,
-              1,  2,  3,  4,  5,  6,  7,  8,  9,  10,
-                2,  3,  4,  5,  6,  7,  8,  9,  10,
-                  3,  4,  5,  6,  7,  8,  9,  10,
-                    4,  5,  6,  7,  8,  9,  10,
-                      5,  6,  7,  8,  9,  10
-        };
-    return i2h0[index];
-}
-
-HexCoord Glinski::hex1(Index index)
-{
-    static const std::vector<HexCoord> i2h1 {
-                  0,  0,  0,  0,  0,  0,
-                1,  1,  1,  1,  1,  1,  1,
-              2,  2,  2,  2,  2,  2,  2,  2,
-            3,  3,  3,  3,  3,  3,  3,  3,  3,
-          4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
-        5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
-          6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
-            7,  7,  7,  7,  7,  7,  7,  7,  7,
-              8,  8,  8,  8,  8,  8,  8,  8,
-                9,  9,  9,  9,  9,  9,  9,
-                  10, 10, 10, 10, 10, 10
-        };
-    return i2h1[index];
-}
-
-bool Glinski::isOnBoard(HexCoord hex0, HexCoord hex1) {
-    bool result =
-           hex0 >= 0          // W
-        && hex0 <= 10         // E
-        && hex1 >= 0          // SW
-        && hex1 <= 10         // NE
-        && hex1 - hex0 <= 5   // NW
-        && hex0 - hex1 <= 5;  // SE
-    return result;
-}
+static_assert(Glinski::hex0(0) == 0 && Glinski::hex1(0) == 0);
+static_assert(Glinski::hexToIndex(5, 5) == 45);  // Center cell (F6)
+static_assert(Glinski::hex0(90) == 10 && Glinski::hex1(90) == 10);
+static_assert(!Glinski::isOnBoard(0, 6) && !Glinski::isOnBoard(-1, 0) && !Glinski::isOnBoard(11, 10));
 
 const Strings Glinski::cellNames {
                    "A1", "B1", "C1", "D1", "E1", "F1",
@@ -160,41 +109,71 @@ const Short Glinski::fenRowLengths[Glinski::ROW_COUNT] {
 // ========================================
 // Initialization of private data
 
-const map<pair<HexCoord, HexCoord>, Index> Glinski::_hexToIndex = []() {
-    map<pair<HexCoord, HexCoord>, Index> result{};
-
-    for (Index index = 0; index < Glinski::CELL_COUNT; ++index) {
-        HexCoord hex0 = Glinski::hex0(index);
-        HexCoord hex1 = Glinski::hex1(index);
-        result[mkPair(hex0, hex1)] = index;
-    }
-    return result;
-}();
-
 const Indices Glinski::getLeapDests(Index index, const HexDirs& dirs) {
     Indices result{};
 
     for (const HexDir& dir : dirs) {
-        HexPos destPos = Glinski::indexToPos(index) + dir;
-        if (isOnBoard(destPos)) {
-            Index destInd = posToIndex(destPos);
-            result.push_back(destInd);
+        Index dest = neighbor(index, BoardDir::dirIndex(dir));
+        if (dest != OFF_BOARD) {
+            result.push_back(dest);
         }
     }
     return result;
 }
 
-const HexRays<Glinski> Glinski::getSlideRays(Index index, const HexDirs& dirs) {
-    HexRays<V> result{};
+// Note: _rayArena, _slideRays, and _slideRayRanges must be initialized in this order,
+//     and before the per-piece ray tables that view them.
+const Indices Glinski::_rayArena { []()
+    {
+        Indices result{};
+        for (Index index = 0; index < Glinski::CELL_COUNT; ++index) {
+            for (DirIndex d = 0; d < BoardDir::SLIDE_DIR_COUNT; ++d) {
+                for (Index cur = neighbor(index, d); cur != OFF_BOARD; cur = neighbor(cur, d)) {
+                    result.push_back(cur);
+                }
+            }
+        }
+        return result;
+    }()
+};
 
-    for (const HexDir& dir : dirs) {
-        HexRay<V> ray{index, dir};
-        if (!ray.isEmpty()) {
-            result.push_back(ray);
+const vector<HexRay<Glinski>> Glinski::_slideRays { []()
+    {
+        vector<HexRay<Glinski>> result{};
+        Short offset = 0;
+        for (Index index = 0; index < Glinski::CELL_COUNT; ++index) {
+            for (DirIndex d = 0; d < BoardDir::SLIDE_DIR_COUNT; ++d) {
+                Short length = 0;
+                for (Index cur = neighbor(index, d); cur != OFF_BOARD; cur = neighbor(cur, d)) {
+                    ++length;
+                }
+                if (length > 0) {
+                    result.push_back(HexRay<Glinski>{index, d, length, offset});
+                    offset += length;
+                }
+            }
         }
-    }
-    return result;
-}
+        assert(offset == static_cast<Short>(_rayArena.size()));
+        return result;
+    }()
+};
+
+const vector<Glinski::SlideRayRange> Glinski::_slideRayRanges { []()
+    {
+        vector<SlideRayRange> result(Glinski::CELL_COUNT, SlideRayRange{0, 0, 0});
+        for (Short k = static_cast<Short>(_slideRays.size()) - 1; k >= 0; --k) {
+            const HexRay<Glinski>& ray = _slideRays[k];
+            SlideRayRange& range = result[ray.start()];
+            range.offset = k;
+            if (ray.dirIndex() < BoardDir::DIAG_DIR_BEGIN) {
+                ++range.orthoCount;
+            } else {
+                ++range.diagCount;
+            }
+        }
+        return result;
+    }()
+};
 
 const vector<Indices> Glinski::kingDests { []()
     {
@@ -208,10 +187,10 @@ const vector<Indices> Glinski::kingDests { []()
 
 const vector<HexRays<Glinski>> Glinski::queenRays { []()
     {
-        vector<HexRays<Glinski>> result;
-        for (Index index = 0; index < Glinski::CELL_COUNT; ++index) {
-            HexRays<Glinski> rays = getSlideRays(index, Glinski::queenSlideDirs);
-            result.push_back(getSlideRays(index, Glinski::queenSlideDirs));
+        vector<HexRays<Glinski>> result{};
+        for (const SlideRayRange& range : _slideRayRanges) {
+            result.push_back(HexRays<Glinski>{_slideRays}
+                .subspan(range.offset, range.orthoCount + range.diagCount));
         }
         return result;
     }()
@@ -219,9 +198,10 @@ const vector<HexRays<Glinski>> Glinski::queenRays { []()
 
 const vector<HexRays<Glinski>> Glinski::rookRays { []()
     {
-        vector<HexRays<Glinski>> result;
-        for (Index index = 0; index < Glinski::CELL_COUNT; ++index) {
-            result.push_back(getSlideRays(index, Glinski::rookSlideDirs));
+        vector<HexRays<Glinski>> result{};
+        for (const SlideRayRange& range : _slideRayRanges) {
+            result.push_back(HexRays<Glinski>{_slideRays}
+                .subspan(range.offset, range.orthoCount));
         }
         return result;
     }()
@@ -230,8 +210,9 @@ const vector<HexRays<Glinski>> Glinski::rookRays { []()
 const vector<HexRays<Glinski>> Glinski::bishopRays { []()
     {
         vector<HexRays<Glinski>> result{};
-        for (Index index = 0; index < Glinski::CELL_COUNT; ++index) {
-            result.push_back(getSlideRays(index, Glinski::bishopSlideDirs));
+        for (const SlideRayRange& range : _slideRayRanges) {
+            result.push_back(HexRays<Glinski>{_slideRays}
+                .subspan(range.offset + range.orthoCount, range.diagCount));
         }
         return result;
     }()
@@ -247,102 +228,154 @@ const vector<Indices> Glinski::knightDests { []()
     }()
 };
 
-const map<Color, map<Index, Indices>> Glinski::colorToPawnAdvance1Indices = []() {
-    map<Color, map<Index, Indices>> result{};
+const Glinski::CellBits Glinski::kingAttacks { []()
+    {
+        CellBits result{};
+        for (Index index = 0; index < Glinski::CELL_COUNT; ++index) {
+            for (Index dest : getLeapDests(index, Glinski::kingLeapDirs)) {
+                result[index].set(dest);
+            }
+        }
+        return result;
+    }()
+};
+
+const Glinski::CellBits Glinski::knightAttacks { []()
+    {
+        CellBits result{};
+        for (Index index = 0; index < Glinski::CELL_COUNT; ++index) {
+            for (Index dest : getLeapDests(index, Glinski::knightLeapDirs)) {
+                result[index].set(dest);
+            }
+        }
+        return result;
+    }()
+};
 
-    for (Color c : {Color::Black, Color::White}) {
-        result[c] = map<Index, Indices>{};
-        for (Index from = 0; from < Glinski::CELL_COUNT; ++from) {
-            HexPos curPos = Glinski::indexToPos(from);
-            HexPos fwd1 = curPos + pawnAdvanceDirs(c)[0];
-            if (isOnBoard(fwd1)) { result[c][from].push_back(Glinski::posToIndex(fwd1)); }
+const std::array<Glinski::CellBits, Glinski::COLOR_COUNT> Glinski::pawnAttacks { []()
+    {
+        std::array<CellBits, COLOR_COUNT> result{};
+        for (Color c : {Color::Black, Color::White}) {
+            for (Index from = 0; from < Glinski::CELL_COUNT; ++from) {
+                for (Index dest : getLeapDests(from, pawnCaptureDirs(c))) {
+                    result[colorIndex(c)][from].set(dest);
+                }
+            }
         }
-    }
-    return result;
-}();
+        return result;
+    }()
+};
 
-// Only use the Pawn's home positions as initial positions.
-// Note: We do not check here to see if the space one ahead of the Pawn is blocked.
-//     That is taken care of by the user of this data.
-const map<Color, map<Index, Indices>> Glinski::colorToPawnAdvance2Indices = []() {
-    map<Color, map<Index, Indices>> result{};
-
-    for (Color c : {Color::Black, Color::White}) {
-        for (Index from : (c == Color::Black ? _bp_indices : _wp_indices)) {
-            HexPos curPos = Glinski::indexToPos(from);
-            for (const HexDir& fdir : V::pawnAdvanceDirs(c)) {
-                HexPos fwd2 = curPos + fdir + fdir;
-                if (V::isOnBoard(fwd2)) {
-                    result[c][from].push_back(Glinski::posToIndex(fwd2));
+const std::array<Glinski::CellBits, Glinski::COLOR_COUNT> Glinski::pawnPush1 { []()
+    {
+        std::array<CellBits, COLOR_COUNT> result{};
+        for (Color c : {Color::Black, Color::White}) {
+            for (Index from = 0; from < Glinski::CELL_COUNT; ++from) {
+                Index fwd1 = neighbor(from, pawnAdvanceDirIndex(c));
+                if (fwd1 != OFF_BOARD) {
+                    result[colorIndex(c)][from].set(fwd1);
                 }
             }
         }
-    }
-    return result;
-}();
+        return result;
+    }()
+};
 
-const map<Color, map<Index, Indices>> Glinski::colorToPawnCaptureIndices = []() {
-    map<Color, map<Index, Indices>> result{};
+// Only use the Pawn's home positions as initial positions.
+const std::array<Glinski::CellBits, Glinski::COLOR_COUNT> Glinski::pawnPush2 { []()
+    {
+        std::array<CellBits, COLOR_COUNT> result{};
+        for (Color c : {Color::Black, Color::White}) {
+            DirIndex d = pawnAdvanceDirIndex(c);
+            for (Index from : (c == Color::Black ? _bp_indices : _wp_indices)) {
+                Index fwd1 = neighbor(from, d);
+                Index fwd2 = fwd1 == OFF_BOARD ? OFF_BOARD : neighbor(fwd1, d);
+                if (fwd2 != OFF_BOARD) {
+                    result[colorIndex(c)][from].set(fwd2);
+                }
+            }
+        }
+        return result;
+    }()
+};
 
-    for (Color c : {Color::Black, Color::White}) {
-        result[c] = map<Index, Indices>{};
+const std::array<Glinski::CellBits, Glinski::CELL_COUNT> Glinski::betweenBits { []()
+    {
+        std::array<CellBits, CELL_COUNT> result{};
         for (Index from = 0; from < Glinski::CELL_COUNT; ++from) {
-            result[c][from] = Indices{};
-            for (HexDir dir : V::pawnCaptureDirs(c)) {
-                HexPos destPos = indexToPos(from) + dir;
-                if (V::isOnBoard(destPos)) {
-                    result[c][from].push_back(posToIndex(destPos));
+            for (DirIndex d = 0; d < BoardDir::SLIDE_DIR_COUNT; ++d) {
+                Bits between{};
+                for (Index dest = neighbor(from, d); dest != OFF_BOARD; dest = neighbor(dest, d)) {
+                    result[from][dest] = between;
+                    between.set(dest);
                 }
             }
         }
-    }
-    return result;
-}();
-
-const map<Color, map<Index, Glinski::Bits>> Glinski::colorToPawnCaptureBits = []() {
-    map<Color, map<Index, Glinski::Bits>> result{};
+        return result;
+    }()
+};
 
-    for (Color c : {Color::Black, Color::White}) {
-        result[c] = map<Index, Glinski::Bits>{};
-        for (Index index = 0; index < Glinski::CELL_COUNT; ++index) {
-            result[c][index] = Glinski::Bits{};
-            for (HexDir dir : V::pawnCaptureDirs(c)) {
-                HexPos destPos = V::indexToPos(index) + dir;
-                if (V::isOnBoard(destPos)) {
-                    result[c][index].set(posToIndex(destPos));
+const std::array<Glinski::DirShifts, BoardDir::SLIDE_DIR_COUNT> Glinski::_dirShifts { []()
+    {
+        std::array<DirShifts, BoardDir::SLIDE_DIR_COUNT> result{};
+        for (DirIndex d = 0; d < BoardDir::SLIDE_DIR_COUNT; ++d) {
+            Short shiftCount = 0;
+            for (Index from = 0; from < Glinski::CELL_COUNT; ++from) {
+                Index dest = neighbor(from, d);
+                if (dest == OFF_BOARD) {
+                    continue;
+                }
+                Short offset = dest - from;
+                Short k = 0;
+                while (k < shiftCount && result[d][k].offset != offset) {
+                    ++k;
                 }
+                if (k == shiftCount) {
+                    if (shiftCount == MAX_DIR_SHIFT_COUNT) {
+                        throw std::logic_error{"Glinski::_dirShifts: Too many distinct offsets"};
+                    }
+                    result[d][shiftCount++].offset = offset;
+                }
+                result[d][k].fromBits.set(from);
             }
         }
-    }
-    return result;
-}();
+        return result;
+    }()
+};
 
-const map<Color, typename Glinski::Bits> Glinski::colorToPawnPromotionBits = []() {
-    map<Color, typename Glinski::Bits> result{};
+const std::array<std::pair<DirIndex, DirIndex>, Glinski::COLOR_COUNT> Glinski::_pawnCaptureDirIndices { []()
+    {
+        std::array<std::pair<DirIndex, DirIndex>, COLOR_COUNT> result{};
+        for (Color c : {Color::Black, Color::White}) {
+            const HexDirs& dirs = pawnCaptureDirs(c);
+            assert(dirs.size() == 2);
+            result[colorIndex(c)] = {BoardDir::dirIndex(dirs[0]), BoardDir::dirIndex(dirs[1])};
+        }
+        return result;
+    }()
+};
 
-    result[Color::Black] = Glinski::Bits();
-    result[Color::White] = Glinski::Bits();
+const std::array<Glinski::Bits, Glinski::COLOR_COUNT> Glinski::colorToPawnPromotionBits = []() {
+    std::array<Glinski::Bits, Glinski::COLOR_COUNT> result{};
 
     std::vector<int> bp_promo{0, 1, 2, 3, 4, 5, 12, 20, 29, 39, 50};
     for (Index k : bp_promo) {
-        result[Color::Black][k] = true;
+        result[colorIndex(Color::Black)].set(k);
     }
     std::vector<int> wp_promo{40, 51, 61, 70, 78, 85, 86, 87, 88, 89, 90};
     for (Index k : wp_promo) {
-        result[Color::White][k] = true;
+        result[colorIndex(Color::White)].set(k);
     }
     return result;
 }();
 
-const map<Color, typename Glinski::Bits> Glinski::colorToPawnStartBits = []() {
-    map<Color, Glinski::Bits> result{};
-    result[Color::Black] = Glinski::Bits();
-    result[Color::White] = Glinski::Bits();
+const std::array<Glinski::Bits, Glinski::COLOR_COUNT> Glinski::colorToPawnStartBits = []() {
+    std::array<Glinski::Bits, Glinski::COLOR_COUNT> result{};
     for (int index : Glinski::_bp_indices) {
-        result[Color::Black][index] = true;
+        result[colorIndex(Color::Black)].set(index);
     }
     for (int index : Glinski::_wp_indices) {
-        result[Color::White][index] = true;
+        result[colorIndex(Color::White)].set(index);
     }
     return result;
 }();
@@ -13,12 +13,18 @@
 
 #pragma once
 
+#include <cassert>
+#include <cstdint>
+
+#include <array>
 #include <map>
 #include <set>
+#include <span>
 #include <utility>
 #include <vector>
 
 #include "geometry.h"
+#include "hex_bits.h"
 #include "util.h"
 #include "util_hexchess.h"
 
@@ -41,6 +47,10 @@ using IndexSet = std::set<Index>;
 /// but from a corner, some directions are blocked, and would be associated
 /// with empty HexRays.
 ///
+/// A HexRay does not own its Indices: It is a view of \p length consecutive entries,
+/// starting at \p offset, in the Variant's ray arena (see V::rayArena()), which holds
+/// the rays from every cell in every slide direction.
+///
 /// \todo Implement support for Castling when adding McCooey or Shafran variants.
 /// \todo There might be a performance gain from using a bitset to test for a capturing
 ///       opportunity before testing individual moves.
@@ -49,18 +59,22 @@ class HexRay {
 public:
     typedef Variant V;
 
-    HexRay(Index start, const HexDir& dir);
-    // ~HexRay() {};
+    constexpr HexRay(Index start, DirIndex dir, Short length, Short offset)
+        : _start{start}, _dir{dir}, _length{length}, _offset{offset}
+    { }
 
-    bool size() const { return _indices.size(); }
-    bool isEmpty() const { return _indices.empty(); }
+    Short size() const { return _length; }
+    bool isEmpty() const { return _length == 0; }
 
     Index start() const { return _start; }
-    HexDir dir() const { return _dir; }
-    const Indices indices() const { return _indices; };
+    HexDir dir() const { return HexDir{BoardDir::steps[_dir].hex0, BoardDir::steps[_dir].hex1}; }
+    DirIndex dirIndex() const { return _dir; }
+    std::span<const Index> indices() const {
+        return std::span<const Index>{V::rayArena().data() + _offset, static_cast<Size>(_length)};
+    }
 
     bool contains(Index index) const {
-        for (Index rayInd : _indices) {
+        for (Index rayInd : indices()) {
             if (rayInd == index) {
                 return true;
             }
@@ -69,26 +83,73 @@ public:
     }
 
 private:
-    Index _start;  // For iterating after batch test found obstruction
-    HexDir _dir;   // For iterating after batch test found obstruction
-    Indices _indices;  // For iterating after batch test found obstruction
+    Index _start;     // For iterating after batch test found obstruction
+    DirIndex _dir;    // For iterating after batch test found obstruction
+    Short _length;    ///< \brief Number of cells in the ray
+    Short _offset;    ///< \brief Position of the ray's first cell in V::rayArena()
 };
 
 /// \brief A collection of HexRays, which can be used to represent possible
 ///        destinations of a slider piece from a specified start Cell.
+///
+/// This is a view into storage owned by the Variant.
 template<typename Variant>
-using HexRays = std::vector<HexRay<Variant>>;
+using HexRays = std::span<const HexRay<Variant>>;
 
 /// \brief The defining info characterizing a HexRay: starting cell and direction.
 using HexRayCore = std::pair<Index, HexDir>;
 using HexRayCores = std::vector<std::pair<Index, HexDir>>;
 
-/// \brief The ObstructedHexRayMap is a map from cells that block sliding chess pieces
-///        to the HexRayCore (starting cell and direction) of the blocked slides.
+/// \brief Compile-time conversion tables between Glinski cell Indices and hex coordinates,
+///        and from each cell to its neighbor in each direction.
 ///
-/// This is used to determinng which pseudo-legal moves are legal.
-/// Specifically, whether a player moving a piece results in auto-check.
-using ObstructedHexRayMap = std::map<Index, HexRayCores>;
+/// Cells are numbered in order of increasing hex1, then increasing hex0, over the
+/// coordinates satisfying 0 <= hex0, hex1 <= 10 and |hex1 - hex0| <= 5.
+struct GlinskiCoordTables {
+    static constexpr Short CELL_COUNT = 91;
+    static constexpr HexCoord HEX_COORD_COUNT = 11;  ///< \brief Each hex coordinate lies in [0, 11).
+    static constexpr Index OFF_BOARD = -1;           ///< \brief Table entry for coordinates off the board.
+
+    HexCoord indexToHex0[CELL_COUNT];
+    HexCoord indexToHex1[CELL_COUNT];
+    Index hexToIndex[HEX_COORD_COUNT][HEX_COORD_COUNT];  ///< \brief Indexed by [hex0][hex1]
+
+    /// \brief The cell reached from each cell by each of BoardDir::steps, or OFF_BOARD.
+    std::int8_t neighbor[CELL_COUNT][BoardDir::DIR_COUNT];
+
+    static constexpr bool isInHexagon(HexCoord hex0, HexCoord hex1) {
+        return hex0 >= 0 && hex0 < HEX_COORD_COUNT
+            && hex1 >= 0 && hex1 < HEX_COORD_COUNT
+            && hex1 - hex0 <= 5 && hex0 - hex1 <= 5;
+    }
+
+    static constexpr GlinskiCoordTables make() {
+        GlinskiCoordTables result{};
+        Index index = 0;
+        for (HexCoord hex1 = 0; hex1 < HEX_COORD_COUNT; ++hex1) {
+            for (HexCoord hex0 = 0; hex0 < HEX_COORD_COUNT; ++hex0) {
+                if (isInHexagon(hex0, hex1)) {
+                    result.indexToHex0[index] = hex0;
+                    result.indexToHex1[index] = hex1;
+                    result.hexToIndex[hex0][hex1] = index;
+                    ++index;
+                } else {
+                    result.hexToIndex[hex0][hex1] = OFF_BOARD;
+                }
+            }
+        }
+        for (Index from = 0; from < CELL_COUNT; ++from) {
+            for (DirIndex d = 0; d < BoardDir::DIR_COUNT; ++d) {
+                HexCoord hex0 = result.indexToHex0[from] + BoardDir::steps[d].hex0;
+                HexCoord hex1 = result.indexToHex1[from] + BoardDir::steps[d].hex1;
+                result.neighbor[from][d] = isInHexagon(hex0, hex1)
+                    ? result.hexToIndex[hex0][hex1]
+                    : OFF_BOARD;
+            }
+        }
+        return result;
+    }
+};
 
 /// \brief All the variant-specific information regarding board, pieces,
 ///        and other rules of play.
@@ -99,9 +160,18 @@ public:
     static constexpr Short CELL_COUNT = 91;       ///< \brief Number of cells (i.e., spaces) on the board
     static constexpr Short COLOR_COUNT = 2;       ///< \brief Number of Colors (i.e., Players)
     static constexpr Short PIECE_TYPE_COUNT = 6;  ///< \brief Types of pieces: King, Queen, Rook, etc.
+
+    /// \brief An upper bound on the number of (pseudo-)legal moves in any position.
+    ///
+    /// From the most open cell, a Queen attacks 42 cells, a Rook 30, a Bishop 14, and a Knight
+    /// or King 12. The worst case is all 9 Pawns promoted to Queens:
+    /// 10 * 42 + 2 * 30 + 3 * 14 + 2 * 12 + 12 = 558.
+    static constexpr Short MAX_MOVE_COUNT = 558;
     static constexpr Short ROW_COUNT = 21;        ///< \brief Rows in this Variant's board. Used in FEN.
 
-    typedef std::bitset<CELL_COUNT> Bits;
+    typedef HexBits<CELL_COUNT> Bits;
+
+    static_assert(GlinskiCoordTables::CELL_COUNT == CELL_COUNT);
 
     // ========================================
     // Board coordinates
@@ -117,12 +187,14 @@ public:
     /// \brief Number of rows. Used for reading and writing FEN strings.
     static const Short fenRowLengths[V::ROW_COUNT];
 
-    static HexCoord hex0(Index index);  ///< \brief Returns the first Hex coordinate of the cell.
-    static HexCoord hex1(Index index);  ///< \brief Returns the second Hex coordinate of the cell.
-    static HexCoord column(Index index) { return hex0(index); }
+    /// \brief Returns the first Hex coordinate of the cell.
+    static constexpr HexCoord hex0(Index index) { return _coords.indexToHex0[index]; }
+    /// \brief Returns the second Hex coordinate of the cell.
+    static constexpr HexCoord hex1(Index index) { return _coords.indexToHex1[index]; }
+    static constexpr HexCoord column(Index index) { return hex0(index); }
 
     // \brief Returns row, where the midline is row #0, Black's home is row #10, and White's is -10
-    static HexCoord row(Index index) { return 2 * hex1(index) - hex0(index) - 5; }
+    static constexpr HexCoord row(Index index) { return 2 * hex1(index) - hex0(index) - 5; }
     static HexCoord rowIncreasingForward(Index index, Color c) {
         HexCoord multiplier = c == Color::Black ? -1 : 1;
         return multiplier * row(index);
@@ -131,12 +203,15 @@ public:
     /// \brief Convert between representaions of a Cell.
     static HexPos indexToPos(Index index) { return HexPos(hex0(index), hex1(index)); }
     /// \brief Convert between representaions of a Cell
-    static Index hexToIndex(HexCoord hex0, HexCoord hex1) { return _hexToIndex.at(mkPair(hex0, hex1)); }
+    static constexpr Index hexToIndex(HexCoord hex0, HexCoord hex1) {
+        assert(isOnBoard(hex0, hex1));
+        return _coords.hexToIndex[hex0][hex1];
+    }
     /// \brief Convert between representaions of a Cell.
     static Index posToIndex(const HexPos& pos) { return hexToIndex(pos.hex0, pos.hex1); }
 
     /// To facilitate finding the en passant square after a Pawn double-step
-    static Index average(Index a, Index b) {
+    static constexpr Index average(Index a, Index b) {
         HexCoord a0 = hex0(a);
         HexCoord a1 = hex1(a);
         HexCoord b0 = hex0(b);
@@ -146,10 +221,24 @@ public:
     }
 
     /// \brief Returns true if the given hex coordinates are on the board.
-    static bool isOnBoard(HexCoord hex0, HexCoord hex1);
+    static constexpr bool isOnBoard(HexCoord hex0, HexCoord hex1) {
+        return static_cast<unsigned>(hex0) < GlinskiCoordTables::HEX_COORD_COUNT
+            && static_cast<unsigned>(hex1) < GlinskiCoordTables::HEX_COORD_COUNT
+            && _coords.hexToIndex[hex0][hex1] != GlinskiCoordTables::OFF_BOARD;
+    }
     /// \brief Returns true if the given HexPos represents a Cell on the board.
     static bool isOnBoard(const HexPos& pos) { return isOnBoard(pos.hex0, pos.hex1); }
 
+    /// \brief Value returned by neighbor() when a step leaves the board.
+    static constexpr Index OFF_BOARD = GlinskiCoordTables::OFF_BOARD;
+
+    /// \brief Returns the cell one step from \p from in direction \p dir
+    ///        (an index into BoardDir::steps), or OFF_BOARD.
+    ///
+    /// A ray is walked by repeated lookups, e.g.,
+    /// `for (Index k = neighbor(from, d); k != OFF_BOARD; k = neighbor(k, d))`.
+    static constexpr Index neighbor(Index from, DirIndex dir) { return _coords.neighbor[from][dir]; }
+
     /// \brief The standard names (e.g., A0, L6, etc.) of the Cells
     static const Strings cellNames;
     static const std::string& cellName(Index index);
@@ -174,12 +263,17 @@ public:
     static const HexDirs& pawnAdvanceDirs(Color c);
     static const HexDirs& pawnCaptureDirs(Color c);
 
+    /// \brief The DirIndex of a Pawn's advance (N for White, S for Black).
+    static constexpr DirIndex pawnAdvanceDirIndex(Color c) {
+        return c == Color::Black ? BoardDir::ORTHO_DIR_BEGIN + 4 : BoardDir::ORTHO_DIR_BEGIN + 1;
+    }
+
     // ========================================
     // Board locations
 
-    static const Bits& pawnPromotionBits(Color c) { return colorToPawnPromotionBits.at(c); }
+    static const Bits& pawnPromotionBits(Color c) { return colorToPawnPromotionBits[colorIndex(c)]; }
     static const PieceTypes promotionPieceTypes;
-    static const Bits& pawnStartBits(Color c) { return colorToPawnStartBits.at(c); }
+    static const Bits& pawnStartBits(Color c) { return colorToPawnStartBits[colorIndex(c)]; }
 
     // static constexpr Index bk_indices[1] = {86};
     // static constexpr Index bq_indices[1] = {78};
@@ -198,15 +292,68 @@ public:
     // ========================================
     // Piece movement lookup
 
-    /// \todo Change method signature to flat-side variants w/ 2 advance dirs (e.g., Brusky, De Vasa)
-    static const Indices pawnAdvance1Indices(Index from, Color c) { return colorToPawnAdvance1Indices.at(c).at(from); }
+    /// \brief One Bits value per cell, e.g., the cells a Knight at a given cell attacks.
+    using CellBits = std::array<Bits, CELL_COUNT>;
+
+    /// \brief Cells a King attacks, indexed by the King's cell. Excludes Castling.
+    static const CellBits kingAttacks;
+
+    /// \brief Cells a Knight attacks, indexed by the Knight's cell.
+    static const CellBits knightAttacks;
 
-    /// \todo Change method signature to flat-side variants w/ 2 advance dirs (e.g., Brusky, De Vasa)
-    static const Indices pawnAdvance2Indices(Index from, Color c) { return colorToPawnAdvance2Indices.at(c).at(from); }
+    /// \brief Cells a Pawn attacks (i.e., could capture on), indexed by [colorIndex(c)][cell].
+    static const std::array<CellBits, COLOR_COUNT> pawnAttacks;
 
-    static const Indices pawnCaptureIndices(Index from, Color c) { return colorToPawnCaptureIndices.at(c).at(from); }
+    /// \brief The cell (if any) a Pawn advances to in one step, indexed by [colorIndex(c)][cell].
+    static const std::array<CellBits, COLOR_COUNT> pawnPush1;
 
-    static const Bits pawnCaptureBits(Index from, Color c) { return colorToPawnCaptureBits.at(c).at(from); }
+    /// \brief The cell a Pawn on its start cell advances to in a double step,
+    ///        indexed by [colorIndex(c)][cell]. Empty for other cells.
+    ///
+    /// Note: This does not check whether the cell in between is blocked.
+    ///       That is taken care of by the user of this data.
+    static const std::array<CellBits, COLOR_COUNT> pawnPush2;
+
+    // ========================================
+    // Set-wise movement: All cells of a Bits at once
+
+    /// \brief Returns the cells one step in slide direction \p d (orthogonal or diagonal)
+    ///        from the cells in \p bits. Steps that leave the board are dropped.
+    ///
+    /// With cells indexed as they are, a step in a given direction adds one of a few constant
+    /// offsets to the Index (one per group of files), so this is a few shift-and-mask operations.
+    static Bits shift(const Bits& bits, DirIndex d) {
+        Bits result{};
+        for (const DirShift& ds : _dirShifts[d]) {
+            const Bits from = bits & ds.fromBits;
+            result |= ds.offset >= 0 ? from << ds.offset : from >> -ds.offset;
+        }
+        return result;
+    }
+
+    /// \brief Returns the cells that Pawns of Color \p c at \p pawns advance to in one step,
+    ///        regardless of occupancy.
+    static Bits pawnPushBits(Color c, const Bits& pawns) {
+        return shift(pawns, pawnAdvanceDirIndex(c));
+    }
+
+    /// \brief Returns the cells attacked by Pawns of Color \p c at \p pawns.
+    static Bits pawnAttackBits(Color c, const Bits& pawns) {
+        const auto& [d0, d1] = _pawnCaptureDirIndices[colorIndex(c)];
+        return shift(pawns, d0) | shift(pawns, d1);
+    }
+
+    /// \brief The DirIndex of each of a Pawn's two capture directions, indexed by colorIndex(c).
+    static DirIndex pawnCaptureDirIndex(Color c, Short k) {
+        return k == 0 ? _pawnCaptureDirIndices[colorIndex(c)].first
+                      : _pawnCaptureDirIndices[colorIndex(c)].second;
+    }
+
+    /// \brief The cells strictly between two cells that share an orthogonal or diagonal line,
+    ///        indexed by [cell][cell]. Empty if the cells share no such line, or are adjacent.
+    ///
+    /// E.g., a check by a slider at \p s on a King at \p k can be blocked on betweenBits[k][s].
+    static const std::array<CellBits, CELL_COUNT> betweenBits;
 
     ///< \brief Represents all Cells a King can leap to, indexed by initial position.
     ///         This does not include Castling, which is handled separately.
@@ -217,26 +364,18 @@ public:
     static const std::vector<HexRays<V>> bishopRays;   ///< \brief Represents all Cells that a Bishop can slide to.
     static const std::vector<Indices>    knightDests;  ///< \brief Represents all Cells that a Knight can leap to.
 
-    /// \brief Represents start and destination Cells for single-step Pawn moves.
-    static const std::map<Color, std::map<Index, Indices>> colorToPawnAdvance1Indices;
-
-    /// \brief Represents start and destination Cells for double-step Pawn moves.
-    static const std::map<Color, std::map<Index, Indices>> colorToPawnAdvance2Indices;
-
-    /// \brief Represents start and destination Cells for Pawn capture moves.
-    static const std::map<Color, std::map<Index, Indices>> colorToPawnCaptureIndices;
-
-    /// \brief Represents start and destination Cells for Pawn capture moves.
-    static const std::map<Color, std::map<Index, Bits>> colorToPawnCaptureBits;
+    /// \brief The Indices of every non-empty ray, from every cell in every slide direction,
+    ///        stored contiguously. HexRay::indices() returns views into this.
+    static const Indices& rayArena() { return _rayArena; }
 
-    /// \brief Static map (per Color) of which Cells lead to Pawn promotion.
-    static const std::map<Color, Bits> colorToPawnPromotionBits;
+    /// \brief Per-Color Bits of which Cells lead to Pawn promotion, indexed by colorIndex(c).
+    static const std::array<Bits, COLOR_COUNT> colorToPawnPromotionBits;
 
-    /// \brief Static map (per Color) of which Cells are Pawn start locations.
+    /// \brief Per-Color Bits of which Cells are Pawn start locations, indexed by colorIndex(c).
     ///
-    /// For each Pawn on its initial locations, colorToPawnAdvance2Indices
+    /// For each Pawn on its initial locations, pawnPush2
     /// can be used to look up destination cells.
-    static const std::map<Color, Bits> colorToPawnStartBits;
+    static const std::array<Bits, COLOR_COUNT> colorToPawnStartBits;
 
     // ========================================
     // Castling
@@ -245,8 +384,8 @@ public:
 
 private:
     // ========== Board geometry
-    /// \brief Lookup map to convert from hex coordinates to Index
-    static const std::map<std::pair<HexCoord, HexCoord>, Index> _hexToIndex;
+    /// \brief Lookup tables to convert between hex coordinates and Index, built at compile time.
+    static constexpr GlinskiCoordTables _coords = GlinskiCoordTables::make();
 
     // ========== Board shading
     /// \brief Array of CellShades, used to determine the shade of a cell from hex coordinates.
@@ -262,8 +401,36 @@ private:
     /// \brief Cached info for determining pseudo-legal moves for "leaper" pieces: King, Knight.
     static const Indices getLeapDests(Index index, const HexDirs& dirs);
 
-    /// \brief Cached info for determining pseudo-legal moves for "slider" pieces: Queen, Rook, Bishop.
-    static const HexRays<V> getSlideRays(Index index, const HexDirs& dirs);
+    /// \brief Backing storage for HexRay::indices(). See rayArena().
+    static const Indices _rayArena;
+
+    /// \brief Every non-empty HexRay, grouped by start cell, and in order of DirIndex
+    ///        within each cell. So each cell's orthogonal rays (for Rooks) precede
+    ///        its diagonal rays (for Bishops), and together they form its Queen rays.
+    static const std::vector<HexRay<V>> _slideRays;
+
+    /// \brief For each cell, the position of its first ray in _slideRays, and the number
+    ///        of its orthogonal and diagonal rays.
+    struct SlideRayRange {
+        Short offset;
+        Short orthoCount;
+        Short diagCount;
+    };
+    static const std::vector<SlideRayRange> _slideRayRanges;
+
+    // ========== Set-wise movement support
+    /// \brief The cells (fromBits) whose neighbor in a given direction has Index + offset.
+    struct DirShift {
+        Short offset;
+        Bits fromBits;
+    };
+    /// \brief The most distinct offsets of a single step in any slide direction (one per
+    ///        group of files, as the files lengthen toward the center of the board and then shorten).
+    static constexpr Short MAX_DIR_SHIFT_COUNT = 5;
+    using DirShifts = std::array<DirShift, MAX_DIR_SHIFT_COUNT>;
+    static const std::array<DirShifts, BoardDir::SLIDE_DIR_COUNT> _dirShifts;
+
+    static const std::array<std::pair<DirIndex, DirIndex>, COLOR_COUNT> _pawnCaptureDirIndices;
 
     // static std::map<Color, std::map<CastlingEnum, Castling>> _castlings;
 };
@@ -36,23 +36,15 @@ template<>
 ZIndex Zobrist<Glinski>::getZIndex(Index index, Color c, PieceType pt) {
     typedef Glinski V;
 
-    static std::map<Color, ZIndex> c2zi{
-        {Color::Black, 0},
-        {Color::White, 1}
-        };
-    static std::map<PieceType, ZIndex> pt2zi{
-        {PieceType::King,   0}, {PieceType::Queen,  1},
-        {PieceType::Rook,   2}, {PieceType::Bishop, 3},
-        {PieceType::Knight, 4}, {PieceType::Pawn,   5}
-        };
-
     ZIndex result = index * V::COLOR_COUNT * V::PIECE_TYPE_COUNT
-                + c2zi.at(c) * V::PIECE_TYPE_COUNT
-                + pt2zi.at(pt);
+                + colorIndex(c) * V::PIECE_TYPE_COUNT
+                + pieceTypeIndex(pt);
     return result;
 }
 
 extern template Zobrist<Glinski>::ZTable Zobrist<Glinski>::_zobristTable;
+extern template ZHash Zobrist<Glinski>::_zobristBlackToMove;
+extern template Zobrist<Glinski>::ZEpTable Zobrist<Glinski>::_zobristEpTable;
 
 template<>
 ZHash Zobrist<Glinski>::getZHash(ZIndex zIndex) {
@@ -65,4 +57,15 @@ ZHash Zobrist<Glinski>::getZHash(Index index, Color c, PieceType pt) {
     return _zobristTable[zIndex];
 }
 
+template<>
+ZHash Zobrist<Glinski>::getMoverZHash(Color mover) {
+    return mover == Color::Black ? _zobristBlackToMove : 0;
+}
+
+template<>
+ZHash Zobrist<Glinski>::getEpZHash(Index epIndex) {
+    assert(epIndex >= 0 && epIndex < Glinski::CELL_COUNT);
+    return _zobristEpTable[epIndex];
+}
+
 }  // namespace hexchess::core
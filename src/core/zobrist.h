@@ -36,14 +36,14 @@ class Zobrist {
 public:
     typedef Variant V;
 
-    /// \brief The size of the Zobrist hash table needed for this variant.
+    /// \brief The size of the Zobrist hash table needed for this variant's piece placements.
     ///
-    /// Note: Some Zobrist hashing scheme make use of en passant conditions.
-    ///     This is not done here, since they are only created by Pawn moves, which
-    ///     reset the Non-progress counter of half-moves without a capture of Pawn move.
+    /// Note: The side to move and the en passant cell have their own keys (see below),
+    ///     so that a Board's hash distinguishes positions that differ only in those.
     static constexpr Size HASH_COUNT = V::CELL_COUNT * V::COLOR_COUNT * V::PIECE_TYPE_COUNT;
 
     using ZTable = std::array<ZHash, HASH_COUNT>;
+    using ZEpTable = std::array<ZHash, V::CELL_COUNT>;
 
     /// \brief Returns the specified value in the Zobrist hash table.
     static ZHash getZHash(ZIndex zIndex);
@@ -54,8 +54,24 @@ public:
 
     /// \brief Returns the appropriate index into the (one-dimensional) Zobrist hash table.
     static ZIndex getZIndex(Index index, Color c, PieceType pt);
+
+    /// \brief Returns the Zobrist hash value for Color \p mover being the side to move.
+    ///
+    /// This is zero for White, so that the hash of a position with White to move
+    /// depends only on its piece placement (and en passant cell).
+    static ZHash getMoverZHash(Color mover);
+
+    /// \brief Returns the Zobrist hash value for an en passant cell at Index \p epIndex.
+    static ZHash getEpZHash(Index epIndex);
+
+    /// \brief Returns the Zobrist hash value for an optional en passant cell (zero if none).
+    static ZHash getEpZHash(OptIndex optEpIndex) {
+        return optEpIndex.has_value() ? getEpZHash(optEpIndex.value()) : 0;
+    }
 private:
     static ZTable _zobristTable;
+    static ZHash _zobristBlackToMove;
+    static ZEpTable _zobristEpTable;
 };
 
 }  // namespace hexchess::core
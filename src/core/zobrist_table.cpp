@@ -1117,4 +1117,104 @@ Zobrist<Glinski>::ZTable Zobrist<Glinski>::_zobristTable{
     0x1cd4f5f756e30ae7
 };
 
+/// A random value XORed into a board's hash when Black is to move.
+template<>
+ZHash Zobrist<Glinski>::_zobristBlackToMove{0xe5bb7a2496e98510};
+
+/// A table of 91 random values, one for each possible en passant cell.
+template<>
+Zobrist<Glinski>::ZEpTable Zobrist<Glinski>::_zobristEpTable{
+    0xa754312add5a7ea4,
+    0x733fdf588eb3032d,
+    0x5fc2dc7c8045cb8c,
+    0xb2e71905f9a75f68,
+    0xc5df10b678051126,
+    0x366ef75ffcbfa489,
+    0x6dc6c6d2e8c0c401,
+    0x5df1f5930bb59930,
+    0x900953c0cc150ea9,
+    0x813ef8e7324127b3,
+    0x0341fa76db929dbc,
+    0x697941f08d55b503,
+    0x126bb8c854944596,
+    0xd244421a6491089a,
+    0x5016d5ce78d5a1cd,
+    0xad914158ba8d2b53,
+    0x0a5a9737f586ac5e,
+    0x665c2610ff042c25,
+    0xf41ff681a143aca3,
+    0x425d232ae9cd2eb2,
+    0x8a97aad1f07d7ad3,
+    0x35a18acd8e7df141,
+    0x063f46da37e4477f,
+    0x1e3ccb7f83b2c7e2,
+    0x01b3a7429fe57d20,
+    0xac469d56f0ce367b,
+    0x34ad8994c08b3c2b,
+    0x94b931f67367a21f,
+    0xed17cef4469bb5f8,
+    0x30faa5bcfa979bd6,
+    0x99a381dffdc7ad41,
+    0x0d52c3a10c360f4a,
+    0xbee023604b7a6145,
+    0xd03db476cc171d75,
+    0x917b4d29a3400eed,
+    0xaa5bfe875f461b3b,
+    0x8d4c192fe44cf416,
+    0x656b1f6bfce1a959,
+    0x989e8d612ac36194,
+    0x46649f737d2f3562,
+    0x460119541eb9a52d,
+    0xfd6394ab5ee8dfd1,
+    0x4d0f4f143a5bdb7a,
+    0xacb417a0ff4611ff,
+    0x922dee0683c69a71,
+    0xbf28a4f2c04e92f5,
+    0x6f6866546f1ab780,
+    0x168d5ac97222b9f7,
+    0x456b2aa630ec5710,
+    0x6ecc293383c3d9a5,
+    0x89227b6ff16c58eb,
+    0x037e9e7126979d3c,
+    0x7205717e59d08e21,
+    0xb101419e5894193b,
+    0x07529b60bac86344,
+    0xb6632b00cba25fb2,
+    0x1a92be237ad44779,
+    0x4cfe3641e747ec23,
+    0x3ae663c288ec864b,
+    0x65bfdf0c2c92e43a,
+    0x85e300c26227355a,
+    0xaacc036a93c4a1d9,
+    0x298dca275cdd2eda,
+    0xb37c741456401aa2,
+    0xba2e4124e012661d,
+    0xfd42f38ca57eda8d,
+    0x9f2c3e64d278b5e2,
+    0x7a9ca59ebb303465,
+    0x28d309858d9e7f96,
+    0xdda75fcf2fe6ac91,
+    0x03decc144dfd908f,
+    0x6e9c499056c3d772,
+    0xcc9dddb2fc46b7d6,
+    0x33c3135c0ae291f3,
+    0x34f083046d57d669,
+    0x8cbc8b05e1ff700b,
+    0xc2de22cd7e34f9bc,
+    0x1e5616b959aaa77e,
+    0xb402dcb45c7f8e46,
+    0x51c640d2ad209923,
+    0x9988339e2c425514,
+    0xebbb2b0c3b434f0c,
+    0x83eab78ec3fe6369,
+    0x402326228689fcdd,
+    0x3593da2cc349f77e,
+    0x41f5cc2ea54a22ff,
+    0xd48cd2fa2e5c7c2f,
+    0x63a9a15dc3c9558e,
+    0xb7d3fe629f8af332,
+    0xb77871a854f7242a,
+    0xdbab182e7f92073b
+};
+
 }  // namespace hexchess::core
@@ -25,6 +25,12 @@ _LIBCPP_DEBUG = 1
 # The flag -fstandalone-debug is only supported clang++, but not g++
 QMAKE_CXXFLAGS += -fstandalone-debug
 
+# Slider attacks are indexed with BMI2's pext instruction when the compiler targets it.
+# Uncomment to enable it on x86-64 CPUs that support it (Haswell and later).
+# On CPUs where pext is slow (AMD before Zen 3), keep magic indexing with HEXCHESS_NO_PEXT.
+#QMAKE_CXXFLAGS += -mbmi2
+#DEFINES += HEXCHESS_NO_PEXT
+
 QMAKE_CXXFLAGS_WARN_ONE = -Werror -Wno-error=unused-parameter
 MOC_DIR = obj
 OBJECTS_DIR = obj
@@ -33,9 +39,10 @@ DESTDIR = obj
 HEADERS += \
     util.h version.h \
     \
-    core/board.h core/fen.h core/game_outcome.h \
-    core/geometry.h core/move.h core/player_action.h \
-    core/util_hexchess.h core/variant.h core/zobrist.h \
+    core/attack_maps.h core/board.h core/fen.h core/game_outcome.h \
+    core/geometry.h core/hex_bits.h core/move.h core/move_list.h core/move_picker.h \
+    core/perft.h core/player_action.h core/position.h core/slider_attacks.h core/util_hexchess.h \
+    core/variant.h core/zobrist.h \
     \
     evaluation/evaluation.h \
     \
@@ -45,6 +52,7 @@ HEADERS += \
     player/player_preference.h \
     player/player_random.h \
     player/search.h \
+    player/transposition_table.h \
     \
     server/server.h server/server_thread.h \
     \
@@ -59,7 +67,10 @@ SOURCES += main.cpp \
     core/game_outcome.cpp \
     core/geometry.cpp \
     core/move.cpp \
+    core/perft.cpp \
     core/player_action.cpp \
+    core/slider_attacks.cpp \
+    core/slider_magics.cpp \
     core/util_hexchess.cpp \
     core/variant.cpp \
     core/zobrist.cpp \
@@ -72,6 +83,7 @@ SOURCES += main.cpp \
     player/player_preference.cpp \
     player/player_random.cpp \
     player/search.cpp \
+    player/transposition_table.cpp \
     \
     server/server.cpp \
     \
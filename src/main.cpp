@@ -16,9 +16,13 @@
 #include <cstdlib>
 #include <cstring>
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <optional>
+#include <string>
 #include <streambuf>
+#include <thread>
 
 #include <QApplication>
 #include <QMetaType>
@@ -28,6 +32,7 @@
 
 #include "board.h"
 #include "move.h"
+#include "perft.h"
 #include "player.h"
 #include "player_action.h"
 #include "player_alpha_beta.h"
@@ -46,13 +51,23 @@ using std::cout;
 using hexchess::print;
 using hexchess::version_string;
 
+using hexchess::core::Board;
 using hexchess::core::Color;
 using hexchess::core::Moves;
+using hexchess::core::NodeCount;
+using hexchess::core::PerftHashTable;
+using hexchess::core::PerftReference;
+using hexchess::core::PerftResult;
 using hexchess::core::PlayerAction;
 using hexchess::core::Scope;
 using hexchess::core::Short;
 using hexchess::core::staticMetaObject;
 
+using hexchess::core::divide;
+using hexchess::core::glinskiPerftReferences;
+using hexchess::core::perftParallelTimed;
+using hexchess::core::perftTimed;
+
 using hexchess::player::connectServerToPlayers;
 using hexchess::player::Player;
 using hexchess::player::PlayerAlphaBeta;
@@ -68,12 +83,110 @@ const char* GLINSKI_DEMO_GAME1{"../resources/games/pgn/Bodor_Hexodus_1999.pgn"};
 const char* GLINSKI_DEMO_GAME2{"../resources/games/pgn/Mackowiak_Hexodus_1999.pgn"};
 const char* GLINSKI_DEMO_GAME3{"../resources/games/pgn/Schenkerik_Hexodus_1999.pgn"};
 
+/// \brief Prints perft counts to each depth up to \p maxDepth, with time and nodes/second.
+///        With \p isDivide, first prints the count below each legal move at \p maxDepth.
+void perftReport(const std::string& fen, Short maxDepth, bool isDivide) {
+    Board<Glinski> b{"perft", fen};
+    cout << "FEN: " << b.fen_string() << "\n";
+    if (isDivide) {
+        NodeCount total = 0;
+        for (const auto& [move, count] : divide(b, maxDepth)) {
+            cout << move.move_pgn_string(false) << ": " << count << "\n";
+            total += count;
+        }
+        cout << "Total: " << total << "\n";
+    }
+    for (Short depth = 1; depth <= maxDepth; ++depth) {
+        PerftResult result = perftTimed(b, depth);
+        cout << "perft(" << depth << ") = " << result.nodes
+             << ", time = " << result.seconds << " s"
+             << ", nodes/second = " << static_cast<NodeCount>(result.nodesPerSecond()) << "\n";
+    }
+}
+
+/// \brief Checks perft counts against the reference table, up to \p maxDepth.
+///        Returns whether all of them matched.
+bool perftReferencesReport(Short maxDepth) {
+    bool isAllMatched = true;
+    for (const PerftReference& ref : glinskiPerftReferences) {
+        Board<Glinski> b{"perft", ref.fen};
+        cout << ref.name << ": " << ref.fen << "\n";
+        for (Short depth = 1; depth <= maxDepth && depth <= static_cast<Short>(ref.counts.size()); ++depth) {
+            PerftResult result = perftTimed(b, depth);
+            bool isMatch = result.nodes == ref.counts[depth - 1];
+            isAllMatched = isAllMatched && isMatch;
+            cout << "    perft(" << depth << ") = " << result.nodes
+                 << (isMatch ? " (ok)" : " (MISMATCH: expected " + std::to_string(ref.counts[depth - 1]) + ")")
+                 << ", time = " << result.seconds << " s"
+                 << ", nodes/second = " << static_cast<NodeCount>(result.nodesPerSecond()) << "\n";
+        }
+    }
+    return isAllMatched;
+}
+
+/// \brief Prints parallel perft counts and times for 1, 2, 4, ... threads, up to \p maxThreadCount,
+///        with the speedup and efficiency (speedup per thread) relative to one thread.
+///        Each run gets a new hash table, so that no run benefits from an earlier one.
+void perftParallelReport(const std::string& fen, Short depth, Short maxThreadCount) {
+    constexpr Size hashMb = 64;
+    Board<Glinski> b{"perft", fen};
+    cout << "FEN: " << b.fen_string() << "\n";
+    std::optional<PerftResult> optSingle{};
+    for (Short threadCount = 1; threadCount <= maxThreadCount;
+         threadCount = (threadCount == maxThreadCount ? maxThreadCount + 1
+                                                      : std::min<Short>(2 * threadCount, maxThreadCount)))
+    {
+        PerftHashTable table{hashMb};
+        PerftResult result = perftParallelTimed(b, depth, threadCount, &table, 2);
+        if (!optSingle.has_value()) {
+            optSingle = result;
+        }
+        double speedup = result.seconds > 0 ? optSingle.value().seconds / result.seconds : 0.0;
+        cout << "threads = " << threadCount
+             << ", perft(" << depth << ") = " << result.nodes
+             << (result.nodes == optSingle.value().nodes ? "" : " (MISMATCH)")
+             << ", time = " << result.seconds << " s"
+             << ", nodes/second = " << static_cast<NodeCount>(result.nodesPerSecond())
+             << ", speedup = " << speedup
+             << ", efficiency = " << speedup / threadCount << "\n";
+    }
+}
+
 /// \todo Modify to support multiple variants
 int main(int argc, char *argv[]) {
     const Scope scope{"main.cpp:main"};
     hexchess::events_verbose = true;
     hexchess::general_verbose = true;
 
+    // Move generation benchmarks, which need neither the GUI nor logging:
+    //     --perft <depth> [<FEN>]   Counts to each depth up to <depth>
+    //     --divide <depth> [<FEN>]  Also counts below each legal move
+    //     --perft_references [<depth>]  Checks the reference counts (to depth 4 by default)
+    //     --perft_parallel <depth> [<threads> [<FEN>]]  Reports thread scaling
+    if (argc >= 3 && argc <= 4
+        && (strcmp(argv[1], "--perft") == 0 || strcmp(argv[1], "--divide") == 0))
+    {
+        hexchess::events_verbose = false;
+        hexchess::general_verbose = false;
+        const std::string fen = argc == 4 ? argv[3] : Glinski::fenInitial;
+        perftReport(fen, std::atoi(argv[2]), strcmp(argv[1], "--divide") == 0);
+        exit(0);
+    }
+    if (argc >= 3 && argc <= 5 && strcmp(argv[1], "--perft_parallel") == 0) {
+        hexchess::events_verbose = false;
+        hexchess::general_verbose = false;
+        const Short threadCount = argc >= 4 ? std::atoi(argv[3])
+                                            : std::max<Short>(1, std::thread::hardware_concurrency());
+        const std::string fen = argc == 5 ? argv[4] : Glinski::fenInitial;
+        perftParallelReport(fen, std::atoi(argv[2]), threadCount);
+        exit(0);
+    }
+    if (argc >= 2 && argc <= 3 && strcmp(argv[1], "--perft_references") == 0) {
+        hexchess::events_verbose = false;
+        hexchess::general_verbose = false;
+        exit(perftReferencesReport(argc == 3 ? std::atoi(argv[2]) : 4) ? 0 : 1);
+    }
+
     qRegisterMetaType<Color>("Color");
     qRegisterMetaType<Fen_Glinski>("Fen<Glinski>");
     qRegisterMetaType<Moves>("Moves");
@@ -77,8 +77,14 @@ void PlayerAlphaBeta::receiveActionRequestFromServer(Color mover, const Moves le
     }
     const Moves& moves = _board.getLegalMoves(mover);
     assert(moves.size() > 0);
-    auto [optBestMove, _] = searchAlphaBeta(_board, mover, _minDepth);
+    const SearchResult result = searchIterativeDeepening(_board, mover, _searchLimits,
+                                                         _transpositionTable);
+    const OptMove& optBestMove = result.optMove;
     assert(optBestMove.has_value());
+    if (hexchess::events_verbose) {
+        print(cout, scope(), "Player ", _name, " searched to depth ", result.depth,
+            " (", result.nodes, " nodes in ", result.seconds, " s)\n");
+    }
     _board.moveExec(optBestMove.value());
     (void) _board.getLegalMoves(_board.mover());
     (void) _board.getCheckEnum();
@@ -17,11 +17,15 @@
 
 #include <QObject>
 
+#include <chrono>
+
 #include "board.h"
 #include "fen.h"
 #include "game_outcome.h"
 #include "player.h"
 #include "player_action.h"
+#include "search.h"
+#include "transposition_table.h"
 #include "util.h"
 #include "util_hexchess.h"
 #include "variant.h"
@@ -50,13 +54,15 @@ public:
     typedef Glinski V;
 
     PlayerAlphaBeta(Short minDepth=3)
-        : _minDepth{minDepth},
-          _name{"PlayerAlphaBeta"}
-    {}
+        : _name{"PlayerAlphaBeta"}
+    {
+        _searchLimits.minDepth = minDepth;
+    }
     PlayerAlphaBeta(const std::string& name, Short minDepth=3)
-        : _minDepth{minDepth},
-          _name{name}
-    {}
+        : _name{name}
+    {
+        _searchLimits.minDepth = minDepth;
+    }
     virtual ~PlayerAlphaBeta() override {};
 
     virtual bool isHuman() const override { return false; }
@@ -67,6 +73,20 @@ public:
     virtual void setGui(MainWindow *mwp) override { _gui = mwp; }
     virtual void showGui() const override { _gui->show(); }
 
+    /// \brief Sets when each move's search stops. The stop request is this player's own.
+    void setSearchLimits(const SearchLimits& limits) {
+        _searchLimits = limits;
+        _searchLimits.optStop = &_stopRequest;
+    }
+
+    /// \brief Asks the search in progress (if any) to stop soon, and play the best move found
+    ///        by a completed iteration. May be called from any thread. A request made while no
+    ///        search is in progress is ignored.
+    void requestStop() { _stopRequest.request(); }
+
+    /// \brief Reallocates the transposition table with about \p sizeMb megabytes.
+    void setTranspositionTableSizeMb(Size sizeMb) { _transpositionTable.resize(sizeMb); }
+
 public slots:
     // ========================================
     // Game <--> Player
@@ -103,8 +123,17 @@ signals:
 protected:
     Board<Glinski> _board{"PlayerAlphaBeta", false};
     MainWindow* _gui;
-    Short _minDepth;
     std::string _name;
+    TranspositionTable _transpositionTable{};  ///< \brief Kept across moves of the game
+    StopRequest _stopRequest{};
+    SearchLimits _searchLimits{
+        .minDepth = minSearchDepth,
+        .maxDepth = maxSearchDepth,
+        .optSoftTime = std::chrono::milliseconds{1'000},
+        .optHardTime = std::chrono::milliseconds{5'000},
+        .optMaxNodes = std::nullopt,
+        .optStop = &_stopRequest
+    };
 };
 
 }  // namespace hexchess::player
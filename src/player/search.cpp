@@ -14,14 +14,19 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "board.h"
 #include "evaluation.h"
 #include "move.h"
+#include "move_picker.h"
 #include "search.h"
+#include "transposition_table.h"
 #include "util.h"
 #include "util_hexchess.h"
 #include "variant.h"
@@ -36,14 +41,90 @@ using hexchess::mkPair;
 using core::Board;
 using core::Color;
 using core::Glinski;
+using core::HalfMoveCounter;
 using core::Move;
+using core::MovePicker;
+using core::NodeCount;
 using core::OptMove;
+using core::Position;
 using core::Scope;
 using core::Short;
 using core::Value;
 
 using evaluation::Evaluation;
 
+/// \brief The value of a drawn position (e.g., one repeated within the search).
+constexpr Value drawValue = 0;
+
+using Clock = std::chrono::steady_clock;
+
+/// \brief The limits of the current iterative deepening search, and its progress.
+struct SearchControl {
+    const SearchLimits& limits;
+    const Clock::time_point start;
+    NodeCount nodes{0};
+    bool isAbortable{false};  ///< \brief False during the first iteration
+    bool isAborted{false};
+};
+
+/// \brief The SearchControl of this thread's iterative deepening search, if any.
+static thread_local SearchControl* activeControl = nullptr;
+
+/// \brief Counts a node, and returns whether the search should be abandoned. The limits are
+///        only checked every SearchLimits::NODES_PER_CHECK nodes, to keep the clock off the
+///        fast path.
+static bool isSearchAborted() {
+    if (!activeControl) {
+        return false;
+    }
+    SearchControl& control = *activeControl;
+    if (control.isAborted) {
+        return true;
+    }
+    if (++control.nodes % SearchLimits::NODES_PER_CHECK != 0 || !control.isAbortable) {
+        return false;
+    }
+    const SearchLimits& limits = control.limits;
+    control.isAborted =
+        (limits.optStop && limits.optStop->isRequested())
+        || (limits.optMaxNodes.has_value() && control.nodes >= limits.optMaxNodes.value())
+        || (limits.optHardTime.has_value() && Clock::now() - control.start >= limits.optHardTime.value());
+    return control.isAborted;
+}
+
+/// \brief Returns the Bound of a value found by searching with the window (\p alpha, \p beta).
+///
+/// Values are from White's point of view at every node, so for either mover, a value at or
+/// below alpha is an upper bound, and one at or above beta is a lower bound.
+static Bound boundOf(Value value, Value alpha, Value beta) {
+    if (value <= alpha) {
+        return Bound::Upper;
+    }
+    return value >= beta ? Bound::Lower : Bound::Exact;
+}
+
+/// \brief Quiet moves that most recently caused a cutoff, indexed by the Board's counter
+///        (i.e., by the ply of the game), for MovePicker to try early at sibling nodes.
+static thread_local std::vector<MovePicker<Glinski>::Killers> killersByCounter{};
+
+static const MovePicker<Glinski>::Killers& getKillers(HalfMoveCounter counter) {
+    if (killersByCounter.size() <= static_cast<std::size_t>(counter)) {
+        killersByCounter.resize(counter + 1);
+    }
+    return killersByCounter[counter];
+}
+
+static void recordKiller(HalfMoveCounter counter, const Move& move) {
+    if (move.isCapture() || move.isPromotion()) {
+        return;  // Already tried early by MovePicker
+    }
+    MovePicker<Glinski>::Killers& killers = killersByCounter[counter];
+    if (killers[0] != std::make_optional(move)) {
+        killers[1] = killers[0];
+        killers[0] = move;
+    }
+}
+
 /// \brief Alpha-beta pruning with quiescent search.
 ///
 /// Traditionally, a board scoring function is chosen so that
@@ -53,7 +134,8 @@ using evaluation::Evaluation;
 ///     \p alpha is the minimum score that the maximizing player (White) can get.
 ///     \p beta is the maximum score that the minimizing player (Black) can get.
 ///
-/// \todo Consider using iterative deeping with cached evaluations.
+/// If called by searchIterativeDeepening, and its limits are reached, this returns promptly
+/// (with std::nullopt and a meaningless value), leaving \p b and \p optTable consistent.
 std::pair<std::optional<Move>, Value> searchAlphaBeta(
     Board<Glinski>& b,
     Color mover,
@@ -61,100 +143,159 @@ std::pair<std::optional<Move>, Value> searchAlphaBeta(
     Value alpha,
     Value beta,
     bool useQuiescentSearch,
-    Short nonQuiescentDepthAdded)
+    Short nonQuiescentDepthAdded,
+    TranspositionTable* optTable,
+    bool isRoot)
 {
-    Scope scope{"search.cpp:searchAlphaBeta"};
+    static const Scope scope{"search.cpp:searchAlphaBeta"};  // Constructed once, not per node
     constexpr Short maxNonQuiescentDepthAdded = 3;  // Avoid diving too deep
+    // Logging builds strings at every node, so it is skipped unless verbose.
+    const bool verbose = hexchess::general_verbose;
 
-    print(cout, scope(), "mover=", color_long_string(mover),
-        ". Entering with depthRemaining=", depthRemaining,
-        ", alpha=", alpha, ", beta=", beta, "\n");
+    if (verbose) {
+        print(cout, scope(), "mover=", color_long_string(mover),
+            ". Entering with depthRemaining=", depthRemaining,
+            ", alpha=", alpha, ", beta=", beta, "\n");
+    }
+    if (isSearchAborted()) {
+        return mkPair(std::nullopt, drawValue);
+    }
     if (depthRemaining == 0 || b.getIsGameOver()) {
         Value v = Evaluation::value(b);
-        if (b.getIsGameOver()) {
+        if (verbose && b.getIsGameOver()) {
             print(cout, scope(), "mover=", color_long_string(mover),
                 ", game in game tree is over: value is ", v, "\n");
         }
         return mkPair(std::nullopt, v);
     }
 
+    // The table is probed before any moves are generated. An entry from a search at least as
+    // deep either settles this node, or narrows its window. Either way, its move is tried first.
+    const Short depth = depthRemaining;  // Quiescent search may extend depthRemaining below
+    const Value alphaOrig = alpha;
+    const Value betaOrig = beta;
+    OptMove optHashMove = std::nullopt;
+    if (optTable) {
+        if (std::optional<TranspositionEntry> optEntry = optTable->probe(b.zobristHash())) {
+            const TranspositionEntry& entry = optEntry.value();
+            optHashMove = entry.optMove;  // MovePicker checks that it is legal
+            // Entries are verified by only 32 bits of the hash, so at the root, where the move
+            // returned is played, an entry is only trusted if its move is legal here.
+            if (entry.depth >= depth
+                && (!isRoot || (entry.optMove.has_value() && b.isLegalMove(entry.optMove.value()))))
+            {
+                if (entry.bound == Bound::Exact) {
+                    return mkPair(entry.optMove, entry.value);
+                } else if (entry.bound == Bound::Lower) {
+                    alpha = std::max(alpha, entry.value);
+                } else if (entry.bound == Bound::Upper) {
+                    beta = std::min(beta, entry.value);
+                }
+                if (alpha >= beta) {
+                    return mkPair(entry.optMove, entry.value);
+                }
+            }
+        }
+    }
+    auto storeResult = [&](Value value, OptMove optBestMove) {
+        if (optTable) {
+            optTable->store(b.zobristHash(), depth, boundOf(value, alphaOrig, betaOrig),
+                            value, optBestMove);
+        }
+    };
+
+    // Moves are generated in stages, and only as needed, so a cutoff skips most generation.
+    const HalfMoveCounter counter = b.currentCounter();
+    const Position<Glinski> saved = b.position();  // Copy-make: restored after each move
+    MovePicker<Glinski> picker{b, optHashMove, getKillers(counter)};
+    OptMove optMove = picker.next();
+    if (!optMove.has_value()) {
+        (void) b.getOutcome();  // Checkmate or Stalemate
+        return mkPair(std::nullopt, Evaluation::value(b));
+    }
+
     if (mover == Color::Black) {
         // Minimizing
         Value minVal = posInfinity;
         std::optional<Move> optBestMove = std::nullopt;
 
-        print(cout, scope(), "mover=", color_long_string(mover),
-            "Count of legal moves=", b.getLegalMoves(mover).size(), "\n");
-        for (const Move& m : b.getLegalMoves(mover)) {
-            string indent(4 * b.currentCounter(), ' ');
-            print(cout, scope(), "(Minimizing) Mover=", color_long_string(mover),
-                indent,
-                ", counter=", b.currentCounter(),
-                ". Evaluating sub-move=", m.move_pgn_string(false), "\n");
-            b.moveExec(m);
-            b.setLegalMoveCheckEnums(b.mover());  // Compute legal moves & check enums
+        for (; optMove.has_value(); optMove = picker.next()) {
+            const Move m = optMove.value();
+            if (verbose) {
+                string indent(4 * b.currentCounter(), ' ');
+                print(cout, scope(), "(Minimizing) Mover=", color_long_string(mover),
+                    indent,
+                    ", counter=", b.currentCounter(),
+                    ". Evaluating sub-move=", m.move_pgn_string(false), "\n");
+            }
+            b.makeMove(m);
 
 #ifdef QUIESCENT_SEARCH
             // Quiescent search
             if (useQuiescentSearch
                 && depthRemaining == 1
                 && nonQuiescentDepthAdded < maxNonQuiescentDepthAdded
-                && (m.isCapture() || m.isPromotion() || m.isCheck()))
+                && (m.isCapture() || m.isPromotion() || b.isOwnCellAttacked(b.getKingIndex(b.mover()))))
             {
                 depthRemaining++;  // Ensure we look at least one ply further
                 nonQuiescentDepthAdded++;
             }
 #endif  // QUIESCENT_SEARCH
 
-            Value value = searchAlphaBeta(
+            // A repeated position is scored as a draw: either side could repeat it again.
+            Value value = b.isRepetition() ? drawValue : searchAlphaBeta(
                 b,
                 nextPlayer(mover),
                 depthRemaining - 1,
                 alpha, beta,
                 useQuiescentSearch,
-                nonQuiescentDepthAdded
+                nonQuiescentDepthAdded,
+                optTable,
+                false
                 ).second;
-            print(cout, scope(), "(Minimizing) Mover=", color_long_string(mover),
-                indent,
-                ", counter=", b.currentCounter(),
-                ". Undoing move ", m.move_pgn_string(false), "\n");
-            b.moveUndo(m);
+            b.setPosition(saved);
+            if (activeControl && activeControl->isAborted) {
+                return mkPair(std::nullopt, drawValue);  // Incomplete, so neither used nor stored
+            }
             if (value < minVal) {
                 minVal = value;
                 optBestMove = std::make_optional(m);
             }
             beta = std::min(beta, value);
             if (alpha >= beta) {
+                recordKiller(counter, m);
                 break;  // alpha cutoff; pruning min; maximizer will block
             }
         }
-        print(cout, scope(), "mover=", color_long_string(mover),
-            ", returning with move=", optBestMove.value().move_pgn_string(true),
-            ", value=", minVal, "\n");
+        if (verbose) {
+            print(cout, scope(), "mover=", color_long_string(mover),
+                ", returning with move=", optBestMove.value().move_pgn_string(false),
+                ", value=", minVal, "\n");
+        }
+        storeResult(minVal, optBestMove);
         return mkPair<OptMove, Value>(optBestMove, minVal);
     } else {
         // Maximizing
         OptMove optBestMove{};
         Value maxVal = negInfinity;
 
-        print(cout, scope(), "mover=", color_long_string(mover),
-            "Count of legal moves=", b.getLegalMoves(mover).size(), "\n");
-        for (const Move& m : b.getLegalMoves(mover)) {
-            string indent(4 * b.currentCounter(), ' ');
-            print(cout, scope(), "(Maximizing) Mover=", color_long_string(mover),
-                indent,
-                ", counter=", b.currentCounter(),
-                ". Evaluating sub-move=", m.move_pgn_string(false), "\n");
-            b.moveExec(m);
-            b.getLegalMoves(b.mover());
-            b.setLegalMoveCheckEnums(b.mover());  // Find legal moves & check enums
+        for (; optMove.has_value(); optMove = picker.next()) {
+            const Move m = optMove.value();
+            if (verbose) {
+                string indent(4 * b.currentCounter(), ' ');
+                print(cout, scope(), "(Maximizing) Mover=", color_long_string(mover),
+                    indent,
+                    ", counter=", b.currentCounter(),
+                    ". Evaluating sub-move=", m.move_pgn_string(false), "\n");
+            }
+            b.makeMove(m);
 
 #ifdef QUIESCENT_SEARCH
             // Quiescent search
             if (useQuiescentSearch) {
                 if (depthRemaining == 1
                     && nonQuiescentDepthAdded < maxNonQuiescentDepthAdded
-                    && (m.isCapture() || m.isPromotion() || m.isCheck()))
+                    && (m.isCapture() || m.isPromotion() || b.isOwnCellAttacked(b.getKingIndex(b.mover()))))
                 {
                     depthRemaining++;  // Ensure we look at least one ply further
                     nonQuiescentDepthAdded++;
@@ -162,31 +303,93 @@ std::pair<std::optional<Move>, Value> searchAlphaBeta(
             }
 #endif  // QUIESCENT_SEARCH
 
-            Value value = searchAlphaBeta(b, nextPlayer(mover),
+            Value value = b.isRepetition() ? drawValue : searchAlphaBeta(b, nextPlayer(mover),
                              depthRemaining - 1,
                              alpha, beta,
                              useQuiescentSearch,
-                             nonQuiescentDepthAdded
+                             nonQuiescentDepthAdded,
+                             optTable,
+                             false
                              ).second;
-            print(cout, scope(), "(Maximizing) Mover=", color_long_string(mover),
-                indent,
-                ", counter=", b.currentCounter(),
-                ". Undoing move ", m.move_pgn_string(false), "\n");
-            b.moveUndo(m);
+            b.setPosition(saved);
+            if (activeControl && activeControl->isAborted) {
+                return mkPair(std::nullopt, drawValue);  // Incomplete, so neither used nor stored
+            }
             if (value > maxVal) {
                 maxVal = value;
                 optBestMove = std::make_optional(m);
             }
             alpha = std::max(alpha, value);
             if (alpha >= beta) {
+                recordKiller(counter, m);
                 break;  // beta cutoff; pruning max; minimizer will block
             }
         }
-        print(cout, scope(), "mover=", color_long_string(mover),
-            ", returning with move=", optBestMove.value().move_pgn_string(true),
-            ", value=", maxVal, "\n");
+        if (verbose) {
+            print(cout, scope(), "mover=", color_long_string(mover),
+                ", returning with move=", optBestMove.value().move_pgn_string(false),
+                ", value=", maxVal, "\n");
+        }
+        storeResult(maxVal, optBestMove);
         return mkPair<Move, Value>(optBestMove.value(), maxVal);
     }
 }
 
+SearchResult searchIterativeDeepening(
+    Board<Glinski>& b,
+    Color mover,
+    const SearchLimits& limits,
+    TranspositionTable& table)
+{
+    static const Scope scope{"search.cpp:searchIterativeDeepening"};
+    const bool verbose = hexchess::general_verbose;
+
+    SearchControl control{limits, Clock::now()};
+    activeControl = &control;
+    // Stop requests are accepted from here until the search ends (also on exception).
+    if (limits.optStop) {
+        limits.optStop->beginSearch();
+    }
+    struct ActiveControlReset {
+        StopRequest* optStop;
+        ~ActiveControlReset() {
+            activeControl = nullptr;
+            if (optStop) {
+                optStop->endSearch();
+            }
+        }
+    } activeControlReset{limits.optStop};
+    table.newSearch();
+    auto elapsed = [&]() { return Clock::now() - control.start; };
+
+    SearchResult result{};
+    for (Short depth = 1; depth <= limits.maxDepth; ++depth) {
+        if (depth > limits.minDepth && limits.optSoftTime.has_value()
+            && elapsed() >= limits.optSoftTime.value())
+        {
+            break;  // Too little time is left to finish another iteration
+        }
+        control.isAbortable = depth > 1;
+        auto [optMove, value] = searchAlphaBeta(b, mover, depth, negInfinity, posInfinity,
+                                                true, 0, &table);
+        if (control.isAborted) {
+            break;
+        }
+        result.optMove = optMove;
+        result.value = value;
+        result.depth = depth;
+        if (verbose) {
+            print(cout, scope(), "depth=", depth, ", move=",
+                optMove.has_value() ? optMove.value().move_pgn_string(false) : string{"none"},
+                ", value=", value, ", nodes=", control.nodes, "\n");
+        }
+        if (!optMove.has_value()) {
+            break;  // The game is over
+        }
+    }
+    result.nodes = control.nodes;
+    result.seconds = std::chrono::duration<double>(elapsed()).count();
+    return result;
+}
+
 }  // namespace hexchess::player
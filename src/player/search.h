@@ -15,8 +15,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <optional>
+
 #include "board.h"
 #include "move.h"
+#include "transposition_table.h"
 #include "util_hexchess.h"
 #include "variant.h"
 
@@ -27,6 +33,8 @@ using core::Board;
 using core::Color;
 using core::Glinski;
 using core::Move;
+using core::NodeCount;
+using core::OptMove;
 using core::Short;
 using core::Value;
 
@@ -34,6 +42,67 @@ using core::negInfinity;
 using core::posInfinity;
 
 constexpr Short minSearchDepth = 3;
+constexpr Short maxSearchDepth = 64;
+
+/// \brief A request, e.g., from another thread, to stop the search in progress.
+///
+/// A request is scoped to one search: it is ignored when no search is in progress, and
+/// cleared when the search ends, so that it can neither be left over for, nor stop, a later one.
+class StopRequest {
+public:
+    /// \brief Asks the search in progress (if any) to stop. May be called from any thread.
+    void request() {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_isSearching) {
+            _isRequested = true;
+        }
+    }
+
+    /// \brief Returns whether the search in progress has been asked to stop.
+    bool isRequested() const { return _isRequested.load(std::memory_order_relaxed); }
+
+    /// \brief Called by the search as it starts and ends.
+    void beginSearch() { _setSearching(true); }
+    void endSearch() { _setSearching(false); }
+
+private:
+    void _setSearching(bool isSearching) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _isSearching = isSearching;
+        _isRequested = false;
+    }
+
+    std::mutex _mutex{};
+    bool _isSearching{false};
+    std::atomic<bool> _isRequested{false};
+};
+
+/// \brief When iterative deepening (see searchIterativeDeepening) stops.
+///
+/// Iterations up to \p minDepth are always started. A deeper one is only started before
+/// \p optSoftTime has passed. Any iteration after the first is abandoned once \p optHardTime
+/// has passed, \p optMaxNodes nodes have been searched, or a stop is requested through
+/// \p optStop; these are checked every SearchLimits::NODES_PER_CHECK nodes.
+struct SearchLimits {
+    using Milliseconds = std::chrono::milliseconds;
+    static constexpr NodeCount NODES_PER_CHECK = 1024;
+
+    Short minDepth{1};
+    Short maxDepth{maxSearchDepth};
+    std::optional<Milliseconds> optSoftTime{std::nullopt};
+    std::optional<Milliseconds> optHardTime{std::nullopt};
+    std::optional<NodeCount> optMaxNodes{std::nullopt};
+    StopRequest* optStop{nullptr};
+};
+
+/// \brief The outcome of searchIterativeDeepening: the result of the deepest completed iteration.
+struct SearchResult {
+    OptMove optMove{std::nullopt};  ///< \brief std::nullopt only if the mover has no legal moves
+    Value value{0};
+    Short depth{0};                 ///< \brief The depth of the deepest completed iteration
+    NodeCount nodes{0};             ///< \brief Nodes searched in all iterations, including any abandoned
+    double seconds{0.0};
+};
 
 /// \brief Alpha-beta pruning with quiescent search.
 ///
@@ -44,7 +113,12 @@ constexpr Short minSearchDepth = 3;
 ///     \p alpha is the minimum score that the maximizing player (White) can get.
 ///     \p beta is the maximum score that the minimizing player (Black) can get.
 ///
-/// \todo Consider using iterative deeping with cached evaluations.
+/// If \p optTable is given, each node's result is stored in it, and looked up before the
+/// node's moves are generated, to skip transpositions and to try the best move found first.
+/// \p isRoot is false only for the recursive calls made by the search itself.
+///
+/// If called by searchIterativeDeepening, and its limits are reached, this returns promptly
+/// (with std::nullopt and a meaningless value), leaving \p b and \p optTable consistent.
 std::pair<std::optional<Move>, Value> searchAlphaBeta(
     Board<Glinski>& b,
     Color mover,
@@ -52,6 +126,20 @@ std::pair<std::optional<Move>, Value> searchAlphaBeta(
     Value alpha=negInfinity,
     Value beta=posInfinity,
     bool useQuiescentSearch=true,
-    Short nonQuiescentDepthAdded=0);
+    Short nonQuiescentDepthAdded=0,
+    TranspositionTable* optTable=nullptr,
+    bool isRoot=true);
+
+/// \brief Searches \p b with searchAlphaBeta at depths 1, 2, 3, ..., within \p limits, and
+///        returns the result of the deepest iteration completed.
+///
+/// Each iteration leaves its results in \p table, so the next one tries the previous one's
+/// best moves first (starting with its best move at the root), and so cuts off sooner.
+/// The first iteration is always completed, so a move is returned if there is one.
+SearchResult searchIterativeDeepening(
+    Board<Glinski>& b,
+    Color mover,
+    const SearchLimits& limits,
+    TranspositionTable& table);
 
 }  // namespace hexchess::player
@@ -0,0 +1,89 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <bit>
+#include <optional>
+
+#include "transposition_table.h"
+
+
+namespace hexchess::player {
+
+void TranspositionTable::resize(Size sizeMb) {
+    const Size bucketCount = std::bit_floor(std::max<Size>(1, sizeMb * 1024 * 1024 / sizeof(Bucket)));
+    _buckets.assign(bucketCount, Bucket{});
+}
+
+void TranspositionTable::clear() {
+    std::fill(_buckets.begin(), _buckets.end(), Bucket{});
+}
+
+std::optional<TranspositionEntry> TranspositionTable::probe(ZHash hash) const {
+    const std::uint32_t check = _check(hash);
+    for (const Entry& e : _bucket(hash).entries) {
+        if (e.bound != Bound::None && e.check == check) {
+            return TranspositionEntry{e.hasMove ? OptMove{e.move} : std::nullopt,
+                                      e.depth, e.bound, e.value};
+        }
+    }
+    return std::nullopt;
+}
+
+void TranspositionTable::store(ZHash hash, Short depth, Bound bound, Value value, OptMove optMove) {
+    const std::uint32_t check = _check(hash);
+    Bucket& bucket = _bucket(hash);
+
+    // An entry for the same position is updated, keeping its move if no new one was found.
+    // Otherwise, the depth-preferred victim is an empty entry, or else one from an earlier search,
+    // or else the shallowest, which is replaced only by a search at least as deep.
+    Entry* target = nullptr;
+    for (Entry& e : bucket.entries) {
+        if (e.bound != Bound::None && e.check == check) {
+            target = &e;
+            break;
+        }
+    }
+    if (target) {
+        if (!optMove.has_value() && target->hasMove) {
+            optMove = target->move;
+        }
+    } else {
+        Entry* victim = &bucket.entries[0];
+        auto priority = [this](const Entry& e) {  // Lower is replaced first
+            return e.bound == Bound::None ? -2 : (e.age != _age ? -1 : e.depth);
+        };
+        for (Short k = 1; k < DEPTH_PREFERRED_COUNT; ++k) {
+            if (priority(bucket.entries[k]) < priority(*victim)) {
+                victim = &bucket.entries[k];
+            }
+        }
+        target = (priority(*victim) < 0 || depth >= victim->depth)
+            ? victim
+            : &bucket.entries[DEPTH_PREFERRED_COUNT];  // Always-replace
+    }
+
+    target->check = check;
+    target->hasMove = optMove.has_value();
+    if (optMove.has_value()) {
+        target->move = optMove.value();
+    }
+    target->value = value;
+    target->depth = static_cast<std::int8_t>(depth);
+    target->bound = bound;
+    target->age = _age;
+}
+
+}  // namespace hexchess::player
@@ -0,0 +1,114 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstdint>
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include "move.h"
+#include "util_hexchess.h"
+#include "zobrist.h"
+
+
+namespace hexchess::player {
+
+using core::Move;
+using core::OptMove;
+using core::Short;
+using core::Size;
+using core::Value;
+using core::ZHash;
+
+/// \brief How a stored search value relates to the true value of the position.
+enum class Bound : std::uint8_t {
+    None,   ///< \brief Empty entry
+    Exact,  ///< \brief The search completed within its (alpha, beta) window
+    Lower,  ///< \brief The search failed high: the true value is at least this
+    Upper   ///< \brief The search failed low: the true value is at most this
+};
+
+/// \brief What a transposition table entry records about a searched position.
+struct TranspositionEntry {
+    OptMove optMove;  ///< \brief The best move found, to be tried first
+    Short depth;      ///< \brief The remaining search depth when the value was found
+    Bound bound;
+    Value value;
+};
+
+/// \brief A fixed-size table of search results, keyed by Zobrist hash, so that a position
+///        reached again (by transposition, or in a later iteration) need not be searched again.
+///
+/// The table is an array of buckets, each one cache line of four 16-byte entries. The low bits
+/// of the hash select the bucket, and the high 32 bits are kept in the entry to verify it.
+/// On a store, an entry for the same position is updated in place. Otherwise the first three
+/// entries are depth-preferred (the shallowest, or one left from an earlier search, is
+/// replaced only by a search at least as deep), and the fourth is always replaced.
+class TranspositionTable {
+public:
+    static constexpr Size DEFAULT_SIZE_MB = 16;
+
+    explicit TranspositionTable(Size sizeMb=DEFAULT_SIZE_MB) { resize(sizeMb); }
+
+    /// \brief Reallocates the table with about \p sizeMb megabytes (rounded down to a power of
+    ///        2 buckets), discarding its contents.
+    void resize(Size sizeMb);
+
+    /// \brief Discards all entries.
+    void clear();
+
+    /// \brief Marks the start of a new search, so that entries from earlier searches are
+    ///        replaced before those of the current one.
+    void newSearch() { ++_age; }
+
+    std::optional<TranspositionEntry> probe(ZHash hash) const;
+
+    void store(ZHash hash, Short depth, Bound bound, Value value, OptMove optMove);
+
+    /// \brief Returns the number of entries (i.e., four per bucket).
+    Size size() const { return _buckets.size() * BUCKET_SIZE; }
+
+private:
+    static constexpr Short BUCKET_SIZE = 4;
+    static constexpr Short DEPTH_PREFERRED_COUNT = BUCKET_SIZE - 1;  ///< \brief The last is always-replace
+
+    struct Entry {
+        std::uint32_t check{0};  ///< \brief High 32 bits of the hash
+        Move move;               ///< \brief Meaningful only if hasMove
+        std::int32_t value{0};
+        std::int8_t depth{0};
+        Bound bound{Bound::None};
+        std::uint8_t age{0};
+        bool hasMove{false};
+    };
+    static_assert(sizeof(Entry) == 16);
+
+    struct alignas(64) Bucket {
+        std::array<Entry, BUCKET_SIZE> entries{};
+    };
+    static_assert(sizeof(Bucket) == 64);
+
+    static std::uint32_t _check(ZHash hash) { return static_cast<std::uint32_t>(hash >> 32); }
+    Bucket& _bucket(ZHash hash) { return _buckets[hash & (_buckets.size() - 1)]; }
+    const Bucket& _bucket(ZHash hash) const { return _buckets[hash & (_buckets.size() - 1)]; }
+
+    std::vector<Bucket> _buckets{};
+    std::uint8_t _age{0};
+};
+
+}  // namespace hexchess::player
@@ -0,0 +1,107 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Finds magic multipliers for SliderAttacks<Glinski>, and writes them to stdout
+// in the form of src/core/slider_magics.cpp. Usage:
+//     obj/slider_magics_gen > ../core/slider_magics.cpp
+//
+// The magics are only used in builds without BMI2's pext (see slider_attacks.h).
+// The search is seeded with a constant, so the output is reproducible.
+
+#include <cstdint>
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+#include "slider_attacks.h"
+#include "variant.h"
+
+
+using std::cout;
+
+using hexchess::core::Glinski;
+using hexchess::core::Index;
+using hexchess::core::Short;
+
+using SA = hexchess::core::SliderAttacks<Glinski>;
+using Lane = SA::Lane;
+
+static std::mt19937_64 prng{0x9e3779b97f4a7c15};
+
+// Multipliers with few set bits are more likely to map subsets to distinct indices.
+Lane findMagicLane(Lane laneMask) {
+    if (laneMask == 0) {
+        return 0;
+    }
+    while (true) {
+        Lane candidate = prng() & prng() & prng();
+        if (SA::isValidMagicLane(laneMask, candidate)) {
+            return candidate;
+        }
+    }
+}
+
+void printLane(Lane lane) {
+    cout << "0x" << std::hex << std::setw(16) << std::setfill('0') << lane << std::dec;
+}
+
+int main() {
+    cout << R"(// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// This file was generated by src/tools/slider_magics_gen. Do not edit.
+
+#include "slider_attacks.h"
+#include "variant.h"
+
+
+namespace hexchess::core {
+
+/// Per-lane magic multipliers, indexed by [Index][line], for builds without pext.
+/// A lane with no relevant cells has multiplier zero.
+template<>
+const SliderAttacks<Glinski>::Magics SliderAttacks<Glinski>::_magics{{
+)";
+    for (Index from = 0; from < Glinski::CELL_COUNT; ++from) {
+        cout << "    {{  // " << from << "\n";
+        for (Short line = 0; line < SA::LINE_COUNT; ++line) {
+            Glinski::Bits mask = SA::relevantMask(from, line);
+            cout << "        {";
+            printLane(findMagicLane(mask.lo()));
+            cout << ", ";
+            printLane(findMagicLane(mask.hi()));
+            cout << "},\n";
+        }
+        cout << "    }},\n";
+    }
+    cout << R"(}};
+
+}  // namespace hexchess::core
+)";
+    return 0;
+}
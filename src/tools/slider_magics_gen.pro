@@ -0,0 +1,26 @@
+######################################################################
+# Generator for src/core/slider_magics.cpp (see slider_magics_gen.cpp)
+######################################################################
+
+TEMPLATE = app
+TARGET = slider_magics_gen
+CONFIG += console
+INCLUDEPATH += .. ../core
+VPATH += ..
+
+QT += core
+QMAKE_CXX = clang++
+QMAKE_CXXFLAGS += -std=c++2a -g -fPIC
+
+MOC_DIR = obj
+OBJECTS_DIR = obj
+DESTDIR = obj
+
+CORE = ../core
+
+HEADERS += \
+    $$CORE/geometry.h $$CORE/hex_bits.h $$CORE/slider_attacks.h \
+    $$CORE/util_hexchess.h $$CORE/variant.h
+
+SOURCES += slider_magics_gen.cpp \
+    $$CORE/geometry.cpp $$CORE/util_hexchess.cpp $$CORE/variant.cpp
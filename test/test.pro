@@ -1,6 +1,6 @@
 TEMPLATE = app
 TARGET = test
-INCLUDEPATH += ../src ../src/core ../src/player ../src/server ../src/ui
+INCLUDEPATH += ../src ../src/core ../src/evaluation ../src/player ../src/server ../src/ui
 VPATH += ../src
 DEFINES += QT_DEPRECATED_WARNINGS
 
@@ -19,38 +19,53 @@ OBJECTS_DIR = obj
 DESTDIR = obj
 
 CORE = ../src/core
+EVALUATION = ../src/evaluation
 PLAYER = ../src/player
 SERVER = ../src/server
 UI = ../src/ui
 TEST = .
 
 HEADERS += \
-    $$CORE/board.h $$CORE/fen.h $$CORE/game_outcome.h \
-    $$CORE/geometry.h $$CORE/move.h $$CORE/variant.h \
-    $$CORE/zobrist.h \
+    $$CORE/attack_maps.h $$CORE/board.h $$CORE/fen.h $$CORE/game_outcome.h \
+    $$CORE/geometry.h $$CORE/hex_bits.h $$CORE/move.h $$CORE/move_list.h $$CORE/move_picker.h \
+    $$CORE/perft.h $$CORE/position.h $$CORE/slider_attacks.h \
+    $$CORE/variant.h $$CORE/zobrist.h \
+    \
+    $$EVALUATION/evaluation.h \
     \
     $$PLAYER/player.h \
     $$PLAYER/player_preference.h \
     $$PLAYER/player_random.h \
+    $$PLAYER/search.h \
+    $$PLAYER/transposition_table.h \
     \
     $$SERVER/server.h \
     \
     $$UI/mainwindow.h $$UI/boardwidget.h $$UI/stylecolor.h \
     $$UI/stylefont.h $$UI/styleicon.h $$UI/stylemeasure.h \
-    $$UI/util_ui.h
+    $$UI/util_ui.h \
+    \
+    $$TEST/test_util.h
 
 SOURCES += $$TEST/test.cpp \
     $$TEST/test_board.cpp $$TEST/test_fen.cpp $$TEST/test_game.cpp \
-    $$TEST/test_geometry.cpp $$TEST/test_move.cpp $$TEST/test_player.cpp \
-    $$TEST/test_zobrist.cpp \
+    $$TEST/test_geometry.cpp $$TEST/test_hex_bits.cpp $$TEST/test_move.cpp \
+    $$TEST/test_move_picker.cpp $$TEST/test_perft.cpp $$TEST/test_player.cpp \
+    $$TEST/test_search.cpp $$TEST/test_slider_attacks.cpp \
+    $$TEST/test_transposition_table.cpp $$TEST/test_zobrist.cpp \
     \
     $$CORE/board.cpp $$CORE/fen.cpp $$CORE/game_outcome.cpp \
-    $$CORE/geometry.cpp $$CORE/move.cpp $$CORE/player_action.cpp \
+    $$CORE/geometry.cpp $$CORE/move.cpp $$CORE/perft.cpp $$CORE/player_action.cpp \
+    $$CORE/slider_attacks.cpp $$CORE/slider_magics.cpp \
     $$CORE/util_hexchess.cpp $$CORE/variant.cpp $$CORE/zobrist.cpp \
     $$CORE/zobrist_table.cpp \
     \
+    $$EVALUATION/evaluation.cpp \
+    \
     $$PLAYER/player_preference.cpp \
     $$PLAYER/player_random.cpp \
+    $$PLAYER/search.cpp \
+    $$PLAYER/transposition_table.cpp \
     \
     $$SERVER/server.cpp \
     \
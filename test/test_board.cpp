@@ -14,8 +14,11 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <random>
 #include <set>
+#include <stdexcept>
 #include <type_traits>
 #include <vector>
 
@@ -23,6 +26,9 @@
 
 #include "board.h"
 #include "geometry.h"
+#include "move.h"
+#include "position.h"
+#include "test_util.h"
 #include "util.h"
 #include "util_hexchess.h"
 #include "variant.h"
@@ -37,13 +43,25 @@ using hexchess::transform_push_back_if;
 using hexchess::core::Board;
 using hexchess::core::BoardDir;
 using hexchess::core::CellShade;
+using hexchess::core::CheckEnum;
 using hexchess::core::Color;
 using hexchess::core::Glinski;
 using hexchess::core::HexDir;
 using hexchess::core::HexPos;
 using hexchess::core::Index;
+using hexchess::core::Move;
+using hexchess::core::MoveEnum;
 using hexchess::core::PieceType;
+using hexchess::core::Position;
 using hexchess::core::Short;
+using hexchess::core::Size;
+using hexchess::core::Termination;
+
+using hexchess::core::colorIndex;
+using hexchess::core::noPieceCode;
+using hexchess::core::pieceCode;
+
+using hexchess::test::forEachRandomGamePosition;
 
 
 /// \brief Test: For each Player, the Bishop starting positions have three different cell shades.
@@ -160,3 +178,265 @@ TEST(BoardTest, BoardPiecePlacement) {
 
     ASSERT_EQ(b.zobristHash(), 0x712bf5ea63571cf5);
 };
+
+/// \brief The per-cell mailbox follows a capture through moveExec and moveUndo.
+TEST(BoardTest, BoardMailboxCaptureExecUndo) {
+    Board<Glinski> b{"Test_BoardMailboxCaptureExecUndo", true};
+    Index from = 37;
+    Index to = Glinski::neighbor(from, BoardDir::ORTHO_DIR_BEGIN);  // NE: A White Pawn capture
+    ASSERT_TRUE(Glinski::pawnAttacks[colorIndex(Color::White)][from].test(to));
+    ASSERT_TRUE(b.isEmpty(to));
+    b.addPiece(to, Color::Black, PieceType::Knight);
+    ASSERT_EQ(b.pieceCodeAt(to), pieceCode(Color::Black, PieceType::Knight));
+
+    Move move{Color::White, PieceType::Pawn, from, to, MoveEnum::Simple,
+              PieceType::Knight, std::nullopt, std::nullopt};
+    b.moveExec(move);
+    ASSERT_EQ(b.pieceCodeAt(from), noPieceCode);
+    ASSERT_EQ(b.pieceCodeAt(to), pieceCode(Color::White, PieceType::Pawn));
+    ASSERT_EQ(b.getPieceTypeAt(to), PieceType::Pawn);
+
+    b.moveUndo(move);
+    ASSERT_EQ(b.pieceCodeAt(from), pieceCode(Color::White, PieceType::Pawn));
+    ASSERT_EQ(b.pieceCodeAt(to), pieceCode(Color::Black, PieceType::Knight));
+    ASSERT_EQ(b.getColorAt(to), Color::Black);
+}
+
+/// \brief Legal moves found with pin masks and the evasion generator match those found by
+///        trying each pseudo-legal move, over random games. Also checks that moveUndo restores
+///        the Board.
+TEST(BoardTest, BoardLegalMovesMatchTrialMoves) {
+    Short checkCount = 0;
+    forEachRandomGamePosition(2021, 4, 80, [&checkCount](Board<Glinski>& b,
+        const Board<Glinski>::VariantMoveList& legalMoves, Short, std::mt19937&)
+    {
+        Color mover = b.mover();
+        const string fenBefore = b.fen_string();
+        if (b.attackersTo(b.getKingIndex(mover), opponent(mover)).any()) {
+            ++checkCount;
+        }
+        Board<Glinski>::VariantMoveList pseudoLegalMoves{};
+        b.findPseudoLegalMoves(pseudoLegalMoves, mover);
+
+        std::set<Move::Code> expected{};
+        for (const Move& move : pseudoLegalMoves) {
+            b.moveExec(move);
+            if (b.attackersTo(b.getKingIndex(mover), opponent(mover)).none()) {
+                expected.insert(move.code());
+            }
+            b.moveUndo(move);
+            ASSERT_EQ(b.fen_string(), fenBefore);
+        }
+        std::set<Move::Code> actual{};
+        for (const Move& move : legalMoves) {
+            actual.insert(move.code());
+        }
+        ASSERT_EQ(actual, expected) << fenBefore;
+    });
+    ASSERT_GT(checkCount, 0);  // The evasion generator was exercised
+}
+
+/// \brief Test: attackersTo (for both Colors, or for one) and isAttacking agree, over random
+///        games, including with an occupancy other than the Board's.
+TEST(BoardTest, BoardAttackersTo) {
+    forEachRandomGamePosition(2021, 1, 60, [](Board<Glinski>& b,
+        const Board<Glinski>::VariantMoveList&, Short, std::mt19937& prng)
+    {
+        const Glinski::Bits occupancy = b.anyPieceBits();
+        Glinski::Bits sparseOccupancy = occupancy;
+        for (Index index : occupancy) {
+            if (prng() % 2 == 0) {
+                sparseOccupancy.reset(index);
+            }
+        }
+        for (Index tgt = 0; tgt < Glinski::CELL_COUNT; ++tgt) {
+            for (const Glinski::Bits& occ : {occupancy, sparseOccupancy}) {
+                ASSERT_EQ(b.attackersTo(tgt, occ),
+                          b.attackersTo(tgt, Color::Black, occ) | b.attackersTo(tgt, Color::White, occ));
+            }
+            for (auto [from, c, pt] : b.piecesDense()) {
+                ASSERT_EQ(b.isAttacking(from, c, pt, tgt), b.attackersTo(tgt, c).test(from))
+                    << b.fen_string() << ": from=" << from << ", tgt=" << tgt;
+            }
+        }
+    });
+}
+
+/// \brief Test: Check and Checkmate are detected from the attackers of the mover's King.
+TEST(BoardTest, BoardCheckmateDetection) {
+    {
+        Board<Glinski> b{"Test_BoardCheckmateDetection", true};
+        ASSERT_EQ(b.getCheckEnum(), CheckEnum::None);
+    }
+    {
+        // Black's King is checked by the White Queen, and has no escape.
+        Board<Glinski> b{"Test_BoardCheckmateDetection", false};
+        b.initialize(string{"b/2/n1n/2kr/p2bp/b1rQ2/1pP2/2ppp1/5/2P3/3p1/4P1/B1P2/4R1/1P1Pq/1P4/PB2P/R3/N1N/1K/B b - - 40 20"});
+        ASSERT_TRUE(b.attackersTo(b.getKingIndex(Color::Black), Color::White).any());
+        ASSERT_EQ(b.getCheckEnum(), CheckEnum::Checkmate);
+        ASSERT_EQ(b.getOutcome().termination(), Termination::Win_Checkmate);
+    }
+}
+
+/// \brief Test: Attack maps maintained incrementally through moveExec and moveUndo match those
+///        computed from scratch, over random games that include captures and promotions.
+TEST(BoardTest, BoardAttackMapsIncremental) {
+    constexpr bool isTrackingAttacks = true;
+    forEachRandomGamePosition(2021, 3, 100, [](Board<Glinski>& b,
+        const Board<Glinski>::VariantMoveList& legalMoves, Short, std::mt19937& prng)
+    {
+        ASSERT_TRUE(b.attackMapsRecompute() == *b.getAttackMaps()) << b.fen_string();
+        for (Color c : {Color::Black, Color::White}) {
+            for (Index index = 0; index < Glinski::CELL_COUNT; ++index) {
+                ASSERT_EQ(b.attackerCount(index, c), b.attackersTo(index, c).count());
+            }
+        }
+        if (legalMoves.empty()) {
+            return;
+        }
+        // Try a move and take it back, before another is made.
+        const Move& trial = legalMoves[prng() % legalMoves.size()];
+        b.moveExec(trial);
+        ASSERT_TRUE(b.attackMapsRecompute() == *b.getAttackMaps()) << b.fen_string();
+        b.moveUndo(trial);
+        ASSERT_TRUE(b.attackMapsRecompute() == *b.getAttackMaps()) << b.fen_string();
+    }, isTrackingAttacks);
+
+    Board<Glinski> b{"Test_BoardAttackMapsIncremental", true};
+    b.setIsTrackingAttacks(true);
+    ASSERT_TRUE(b.isTrackingAttacks());
+    b.setIsTrackingAttacks(false);
+    ASSERT_FALSE(b.isTrackingAttacks());
+}
+
+/// \brief Test: Over random games, makeMove reaches the same position (and Zobrist hash)
+///        as moveExec, and unmakeMove restores the position it was made from.
+TEST(BoardTest, BoardMakeUnmakeMove) {
+    constexpr bool isTrackingAttacks = true;
+    forEachRandomGamePosition(2021, 3, 100, [](Board<Glinski>& b,
+        const Board<Glinski>::VariantMoveList& legalMoves, Short, std::mt19937&)
+    {
+        const string fen = b.fen_string();
+        const auto hash = b.zobristHash();
+        Board<Glinski> expected{"Test_BoardMakeUnmakeMove_Expected", b.position()};
+        for (const Move& move : legalMoves) {
+            Board<Glinski>::UndoInfo undo;
+            b.makeMove(move, undo);
+            if (move.isCapture() || move.pieceType() == PieceType::Pawn) {  // moveUndo is slow
+                expected.moveExec(move);
+                ASSERT_EQ(b.fen_string(), expected.fen_string()) << fen;
+                ASSERT_EQ(b.zobristHash(), expected.zobristHash()) << fen;
+                expected.moveUndo(move);
+            }
+            ASSERT_EQ(b.zobristHash(), b.zobristHashRecompute()) << fen;
+            ASSERT_TRUE(b.attackMapsRecompute() == *b.getAttackMaps()) << fen;
+            b.unmakeMove(move, undo);
+            ASSERT_EQ(b.fen_string(), fen);
+            ASSERT_EQ(b.zobristHash(), hash) << fen;
+        }
+    }, isTrackingAttacks);
+}
+
+/// \brief Test: A Position survives a byte-wise copy, a Board built from it matches the
+///        original, and setPosition restores the position after makeMove (copy-make).
+TEST(BoardTest, BoardPositionSnapshot) {
+    constexpr bool isTrackingAttacks = true;
+    forEachRandomGamePosition(2021, 1, 100, [](Board<Glinski>& b,
+        const Board<Glinski>::VariantMoveList& legalMoves, Short, std::mt19937&)
+    {
+        const string fen = b.fen_string();
+        Position<Glinski> saved;
+        std::memcpy(&saved, &b.position(), sizeof(saved));
+
+        Board<Glinski> copy{"Test_BoardPositionSnapshot_Copy", saved};
+        ASSERT_EQ(copy.fen_string(), fen);
+        ASSERT_EQ(copy.zobristHash(), b.zobristHash());
+        ASSERT_EQ(copy.zobristHash(), copy.zobristHashRecompute());
+
+        for (const Move& move : legalMoves) {
+            b.makeMove(move);
+            b.setPosition(saved);
+            ASSERT_EQ(b.fen_string(), fen);
+            ASSERT_EQ(b.zobristHash(), saved.zHash);
+        }
+        ASSERT_TRUE(b.attackMapsRecompute() == *b.getAttackMaps()) << fen;
+    }, isTrackingAttacks);
+}
+
+/// \brief Test: Knights shuffling out and back repeat the initial position, which is detected
+///        through both moveExec and makeMove, and becomes a draw on its third occurrence.
+///        Undoing a move restores the non-progress counter that bounds the search for repeats.
+TEST(BoardTest, BoardRepetition) {
+    Board<Glinski> b{"Test_BoardRepetition", true};
+    auto findKnightMove = [&b](Index from, Index to) {
+        Board<Glinski>::VariantMoveList moves{};
+        b.findLegalMoves(moves, b.mover());
+        for (const Move& move : moves) {
+            if (move.pieceType() == PieceType::Knight && (from == -1 || move.from() == from)
+                && (to == -1 || move.to() == to))
+            {
+                return move;
+            }
+        }
+        throw std::logic_error{"Test_BoardRepetition: Move not found"};
+    };
+    const Move wOut = findKnightMove(-1, -1);
+    b.moveExec(wOut);
+    const Move bOut = findKnightMove(-1, -1);
+    b.moveExec(bOut);
+    const Move wBack = findKnightMove(wOut.to(), wOut.from());
+    b.moveExec(wBack);
+    const Move bBack = findKnightMove(bOut.to(), bOut.from());
+
+    // Through makeMove, as in search
+    Board<Glinski>::UndoInfo undo;
+    ASSERT_FALSE(b.isRepetition());
+    b.makeMove(bBack, undo);
+    ASSERT_TRUE(b.isRepetition());
+    ASSERT_FALSE(b.isRepetition(2));
+    b.unmakeMove(bBack, undo);
+    ASSERT_FALSE(b.isRepetition());
+
+    // Through moveExec, as in a game
+    b.moveExec(bBack);
+    ASSERT_TRUE(b.isRepetition());
+    ASSERT_NE(b.getOutcome().termination(), Termination::Draw_3xBoardRepetition);
+    for (const Move& move : {wOut, bOut, wBack}) {
+        b.moveExec(move);
+        ASSERT_FALSE(b.isRepetition(2));
+    }
+    const Short nonProgressCounter = b.position().nonProgressCounter;
+    b.moveExec(bBack);
+    ASSERT_TRUE(b.isRepetition(2));
+    ASSERT_FALSE(b.isRepetition(3));
+    ASSERT_EQ(b.getOutcome().termination(), Termination::Draw_3xBoardRepetition);
+
+    b.moveUndo(bBack);
+    ASSERT_EQ(b.position().nonProgressCounter, nonProgressCounter);
+    ASSERT_FALSE(b.isRepetition(2));
+    b.moveExec(bBack);
+    ASSERT_TRUE(b.isRepetition(2));
+}
+
+/// \brief Test: Cached legal moves and move CheckEnums stay correct as moves are made and
+///        taken back, which invalidates the cache by generation rather than by clearing it.
+TEST(BoardTest, BoardCacheInvalidation) {
+    forEachRandomGamePosition(2021, 1, 100, [](Board<Glinski>& b,
+        const Board<Glinski>::VariantMoveList& legalMoves, Short, std::mt19937&)
+    {
+        vector<CheckEnum> expected{};
+        for (const Move& move : legalMoves) {
+            Board<Glinski>::UndoInfo undo;
+            b.makeMove(move, undo);
+            const bool isCheck = b.attackersTo(b.getKingIndex(b.mover()), opponent(b.mover())).any();
+            b.unmakeMove(move, undo);
+            expected.push_back(isCheck ? CheckEnum::Check : CheckEnum::None);
+        }
+        for (Short pass = 0; pass < 2; ++pass) {  // The 2nd pass reads from the cache
+            ASSERT_EQ(b.getLegalMoves(b.mover()), legalMoves.toMoves());
+            for (Size k = 0; k < legalMoves.size(); ++k) {
+                ASSERT_EQ(b.getMoveCheckEnum(legalMoves[k]), expected[k]);
+            }
+        }
+    });
+}
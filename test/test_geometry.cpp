@@ -28,10 +28,14 @@ using std::cout;
 
 using hexchess::NotImplementedException;
 
+using hexchess::core::BoardDir;
+using hexchess::core::Color;
+using hexchess::core::DirIndex;
 using hexchess::core::Glinski;
 using hexchess::core::HexDir;
 using hexchess::core::HexPos;
 using hexchess::core::Index;
+using hexchess::core::Size;
 
 
 // Note: Currently not invoked
@@ -85,3 +89,91 @@ TEST(GeometryTest, GeometryPositiveDirection) {
     ASSERT_EQ(knightDest.hex1, 7);
     ASSERT_EQ(V::posToIndex(knightDest), 65);
 }
+
+/// \brief Test: The neighbor table agrees with HexPos + HexDir arithmetic for every cell and step.
+TEST(GeometryTest, GeometryNeighborTable) {
+    typedef Glinski V;
+
+    ASSERT_EQ(BoardDir::allDirs.size() + BoardDir::knightLeapDirs.size(), BoardDir::DIR_COUNT);
+    for (DirIndex d = 0; d < BoardDir::DIR_COUNT; ++d) {
+        const HexDir& dir = d < BoardDir::SLIDE_DIR_COUNT
+            ? BoardDir::allDirs[d]
+            : BoardDir::knightLeapDirs[d - BoardDir::KNIGHT_DIR_BEGIN];
+        ASSERT_EQ(BoardDir::dirIndex(dir), d);
+        DirIndex r = BoardDir::reverseDir(d);
+        ASSERT_EQ(BoardDir::steps[r].hex0, -BoardDir::steps[d].hex0);
+        ASSERT_EQ(BoardDir::steps[r].hex1, -BoardDir::steps[d].hex1);
+
+        for (Index from = 0; from < V::CELL_COUNT; ++from) {
+            HexPos dest = V::indexToPos(from) + dir;
+            Index expected = V::isOnBoard(dest) ? V::posToIndex(dest) : V::OFF_BOARD;
+            ASSERT_EQ(V::neighbor(from, d), expected);
+        }
+    }
+
+    // From the center, every step stays on the board.
+    const Index CENTER_INDEX = 45;
+    for (DirIndex d = 0; d < BoardDir::DIR_COUNT; ++d) {
+        ASSERT_NE(V::neighbor(CENTER_INDEX, d), V::OFF_BOARD);
+    }
+}
+
+/// \brief Test: betweenBits holds the cells strictly between two cells on a common slide line,
+///        is symmetric, and is empty for adjacent or unaligned pairs.
+TEST(GeometryTest, GeometryBetweenBits) {
+    typedef Glinski V;
+
+    Size pairCount = 0;
+    for (Index from = 0; from < V::CELL_COUNT; ++from) {
+        for (Index dest = 0; dest < V::CELL_COUNT; ++dest) {
+            ASSERT_EQ(V::betweenBits[from][dest], V::betweenBits[dest][from]);
+            if (V::betweenBits[from][dest].any()) {
+                ++pairCount;
+            }
+        }
+        for (DirIndex d = 0; d < BoardDir::SLIDE_DIR_COUNT; ++d) {
+            Index adjacent = V::neighbor(from, d);
+            if (adjacent != V::OFF_BOARD) {
+                ASSERT_TRUE(V::betweenBits[from][adjacent].none());
+            }
+        }
+    }
+    ASSERT_GT(pairCount, 0);
+
+    // Along a file, the center is between the two cells two steps away.
+    const Index CENTER_INDEX = 45;
+    Index n1 = V::neighbor(CENTER_INDEX, 1);
+    Index s1 = V::neighbor(CENTER_INDEX, 4);
+    Index s2 = V::neighbor(s1, 4);
+    ASSERT_TRUE(V::betweenBits[n1][s1].test(CENTER_INDEX));
+    ASSERT_EQ(V::betweenBits[n1][s2].count(), 2);
+    // A knight leap is not a line.
+    ASSERT_TRUE(V::betweenBits[CENTER_INDEX][V::neighbor(CENTER_INDEX, BoardDir::KNIGHT_DIR_BEGIN)].none());
+}
+
+/// \brief Test: Set-wise shifts agree with the neighbor table, and the set-wise Pawn maps
+///        agree with the per-cell Pawn tables.
+TEST(GeometryTest, GeometrySetWiseShifts) {
+    typedef Glinski V;
+
+    for (DirIndex d = 0; d < BoardDir::SLIDE_DIR_COUNT; ++d) {
+        V::Bits expectedAll{};
+        for (Index from = 0; from < V::CELL_COUNT; ++from) {
+            Index dest = V::neighbor(from, d);
+            V::Bits expected = dest == V::OFF_BOARD ? V::Bits{} : V::Bits::fromIndex(dest);
+            ASSERT_EQ(V::shift(V::Bits::fromIndex(from), d), expected);
+            expectedAll |= expected;
+        }
+        ASSERT_EQ(V::shift(V::Bits::all(), d), expectedAll);
+    }
+    for (Color c : {Color::Black, Color::White}) {
+        V::Bits allAttacks{};
+        for (Index from = 0; from < V::CELL_COUNT; ++from) {
+            V::Bits pawn = V::Bits::fromIndex(from);
+            ASSERT_EQ(V::pawnPushBits(c, pawn), V::pawnPush1[colorIndex(c)][from]);
+            ASSERT_EQ(V::pawnAttackBits(c, pawn), V::pawnAttacks[colorIndex(c)][from]);
+            allAttacks |= V::pawnAttacks[colorIndex(c)][from];
+        }
+        ASSERT_EQ(V::pawnAttackBits(c, V::Bits::all()), allAttacks);
+    }
+}
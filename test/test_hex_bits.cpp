@@ -0,0 +1,90 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <iostream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "hex_bits.h"
+#include "util_hexchess.h"
+#include "variant.h"
+
+using std::vector;
+
+using hexchess::core::Glinski;
+using hexchess::core::Index;
+using hexchess::core::Indices;
+
+
+TEST(HexBitsTest, HexBitsSetTestCount) {
+    Glinski::Bits bits{};
+    ASSERT_TRUE(bits.none());
+
+    for (Index index : {0, 5, 63, 64, 90}) {
+        bits.set(index);
+    }
+    ASSERT_EQ(bits.count(), 5);
+    ASSERT_TRUE(bits.test(63));
+    ASSERT_TRUE(bits.test(64));
+    ASSERT_FALSE(bits.test(62));
+
+    bits.reset(63);
+    ASSERT_EQ(bits.count(), 4);
+    ASSERT_FALSE(bits[63]);
+}
+
+TEST(HexBitsTest, HexBitsIteration) {
+    Glinski::Bits bits{};
+    Indices expected{3, 12, 45, 70, 86};
+    for (Index index : expected) {
+        bits.set(index);
+    }
+    ASSERT_EQ(bits.lsb(), 3);
+
+    Indices visited{};
+    for (Index index : bits) {
+        visited.push_back(index);
+    }
+    ASSERT_EQ(visited, expected);
+
+    Indices popped{};
+    while (bits.any()) {
+        popped.push_back(bits.popLsb());
+    }
+    ASSERT_EQ(popped, expected);
+}
+
+TEST(HexBitsTest, HexBitsComplementStaysOnBoard) {
+    Glinski::Bits all = Glinski::Bits::all();
+    ASSERT_EQ(all.count(), Glinski::CELL_COUNT);
+    ASSERT_TRUE((~all).none());
+
+    Glinski::Bits center = Glinski::Bits::fromIndex(45);
+    ASSERT_EQ((~center).count(), Glinski::CELL_COUNT - 1);
+}
+
+TEST(HexBitsTest, HexBitsShiftAcrossLanes) {
+    Glinski::Bits bits = Glinski::Bits::fromIndex(60);
+
+    ASSERT_EQ((bits << 10).lsb(), 70);
+    ASSERT_EQ(((bits << 10) >> 10).lsb(), 60);
+    ASSERT_TRUE((bits << 31).none());  // Shifted off the board
+    ASSERT_TRUE((bits >> 61).none());
+
+    Glinski::Bits edgeMask = Glinski::Bits::fromIndex(70);
+    ASSERT_EQ(bits.shifted(10, edgeMask), edgeMask);
+    ASSERT_TRUE(bits.shifted(-10, edgeMask).none());
+}
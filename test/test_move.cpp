@@ -19,6 +19,7 @@
 
 #include "board.h"
 #include "move.h"
+#include "move_list.h"
 #include "util_hexchess.h"
 #include "variant.h"
 
@@ -27,6 +28,7 @@ using std::cout;
 using std::vector;
 
 using hexchess::core::Board;
+using hexchess::core::CheckEnum;
 using hexchess::core::Color;
 using hexchess::core::Glinski;
 using hexchess::core::HexRay;
@@ -34,6 +36,8 @@ using hexchess::core::HexRays;
 using hexchess::core::Index;
 using hexchess::core::Indices;
 using hexchess::core::Move;
+using hexchess::core::MoveEnum;
+using hexchess::core::MoveList;
 using hexchess::core::Moves;
 using hexchess::core::PieceType;
 using hexchess::core::Short;
@@ -50,9 +54,20 @@ Short move_count_leaper(const vector<Indices>& destTable, bool verbose=false) {
     return result;
 }
 
+/// \brief Test: Find the move count of Leaper over all starting points, using attack Bits.
+Short move_count_leaper(const Glinski::CellBits& attacksTable) {
+    Short result = 0;
+
+    for (Index index = 0; index < Glinski::CELL_COUNT; ++index) {
+        result += attacksTable[index].count();
+    }
+    return result;
+}
+
 /// \brief Test: Find the move count of a Slider over all starting points.
 ///
-/// Note: As of 2021-08-19, this returns smaller values than expected.
+/// Note: Until HexRay::size() returned the ray's length (rather than a bool),
+///       this counted the non-empty rays instead. See ray_count_slider.
 Short move_count_slider(const vector<HexRays<Glinski>>& slideRayTable, bool verbose=false) {
     Short result = 0;
 
@@ -64,6 +79,16 @@ Short move_count_slider(const vector<HexRays<Glinski>>& slideRayTable, bool verb
     return result;
 }
 
+/// \brief Test: Find the number of (non-empty) rays of a Slider over all starting points.
+Short ray_count_slider(const vector<HexRays<Glinski>>& slideRayTable) {
+    Short result = 0;
+
+    for (Index index = 0; index < Glinski::CELL_COUNT; ++index) {
+        result += slideRayTable[index].size();
+    }
+    return result;
+}
+
 /// \brief Test: Test the count of all King moves over all starting points.
 ///
 ///     Kings @ inner 37 cells have 12 moves each (444)
@@ -77,6 +102,7 @@ TEST(MoveTest, MoveCountKing) {
         cout << "King:   Move count = " << move_count << "\n";
     }
     ASSERT_EQ(move_count, 900);
+    ASSERT_EQ(move_count_leaper(Glinski::kingAttacks), 900);
 }
 
 /// \brief Test: Test the count of all Queen moves over all starting points.
@@ -87,7 +113,8 @@ TEST(MoveTest, MoveCountQueen) {
     if (verbose) {
         cout << "Queen:  Move count = " << move_count << "\n";
     }
-    ASSERT_EQ(move_count, 900);
+    ASSERT_EQ(move_count, 3150);
+    ASSERT_EQ(ray_count_slider(Glinski::queenRays), 900);
 }
 
 /// \brief Test: Test the count of all Rook moves over all starting points.
@@ -98,7 +125,8 @@ TEST(MoveTest, MoveCountRook) {
     if (verbose) {
         cout << "Rook:   Move count = " << move_count << "\n";
     }
-    ASSERT_EQ(move_count, 480);
+    ASSERT_EQ(move_count, 2070);
+    ASSERT_EQ(ray_count_slider(Glinski::rookRays), 480);
 }
 
 /// \brief Test: Test the count of all Bishop moves over all starting points.
@@ -109,7 +137,8 @@ TEST(MoveTest, MoveCountBishop) {
     if (verbose) {
         cout << "Bishop: Move count = " << move_count << "\n";
     }
-    ASSERT_EQ(move_count, 420);
+    ASSERT_EQ(move_count, 1080);
+    ASSERT_EQ(ray_count_slider(Glinski::bishopRays), 420);
 }
 
 /// \brief Test: Test the count of all Knight moves over all starting points.
@@ -129,6 +158,33 @@ TEST(MoveTest, MoveCountKnight) {
         cout << "Knight move count=" << move_count << "\n";
     }
     ASSERT_EQ(move_count, 720);
+    ASSERT_EQ(move_count_leaper(Glinski::knightAttacks), 720);
+}
+
+/// \brief Test: A Move's fields survive packing, and equality compares all of them.
+TEST(MoveTest, MovePackedFields) {
+    constexpr Move promo{Color::Black, PieceType::Pawn, 13, 90,
+                         MoveEnum::PawnPromotion, PieceType::Rook, PieceType::Queen};
+    static_assert(promo.from() == 13 && promo.to() == 90);
+    static_assert(promo.isCapture() && promo.isPromotion() && !promo.hasCheckEnum());
+
+    ASSERT_EQ(promo.mover(), Color::Black);
+    ASSERT_EQ(promo.pieceType(), PieceType::Pawn);
+    ASSERT_EQ(promo.moveEnum(), MoveEnum::PawnPromotion);
+    ASSERT_EQ(promo.optCaptured(), PieceType::Rook);
+    ASSERT_EQ(promo.optPromotedTo(), PieceType::Queen);
+
+    Move simple{Color::White, PieceType::Knight, 0, 89};
+    ASSERT_EQ(simple.mover(), Color::White);
+    ASSERT_FALSE(simple.isCapture());
+    ASSERT_FALSE(simple.optPromotedTo().has_value());
+
+    Move checked = simple;
+    ASSERT_EQ(checked, simple);
+    checked.setCheckEnum(CheckEnum::Checkmate);
+    ASSERT_TRUE(checked.isCheckmate());
+    ASSERT_FALSE(checked == simple);
+    ASSERT_EQ(checked.getHash(), simple.getHash());  // The hash ignores the CheckEnum
 }
 
 /// \brief Test: Test the count of all legal starting moves.
@@ -173,3 +229,21 @@ TEST(MoveTest, MoveCountBoard) {
                        + bExp + nExp + pExp;
     ASSERT_EQ(wMoves.size(), expectedCount);
 }
+
+/// \brief Test: Legal moves written to inline storage match those returned through the cache.
+TEST(MoveTest, MoveListLegalMoves) {
+    MoveList<4> small{};
+    ASSERT_TRUE(small.empty());
+    small.emplace_back(Color::White, PieceType::Knight, 0, 89);
+    small.push_back(Move{Color::White, PieceType::Rook, 1, 2});
+    ASSERT_EQ(small.size(), 2);
+    ASSERT_EQ(small[1].pieceType(), PieceType::Rook);
+    ASSERT_EQ(small.toMoves().size(), 2);
+
+    Board<Glinski> b{"Test_MoveListLegalMoves", false};  // Initial game layout
+    b.initialize(Glinski::fenInitial);
+    Board<Glinski>::VariantMoveList moves{};
+    b.findLegalMoves(moves, Color::White);
+    ASSERT_EQ(moves.size(), 51);
+    ASSERT_EQ(moves.toMoves(), b.getLegalMoves(Color::White));
+}
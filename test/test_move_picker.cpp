@@ -0,0 +1,120 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <limits>
+#include <random>
+#include <set>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "board.h"
+#include "move.h"
+#include "move_picker.h"
+#include "test_util.h"
+#include "util_hexchess.h"
+#include "variant.h"
+
+using std::string;
+
+using hexchess::core::Board;
+using hexchess::core::Color;
+using hexchess::core::Glinski;
+using hexchess::core::Move;
+using hexchess::core::MovePicker;
+using hexchess::core::OptMove;
+using hexchess::core::Short;
+using hexchess::core::Size;
+using hexchess::core::Value;
+
+using hexchess::test::forEachRandomGamePosition;
+
+
+/// \brief Test: In the initial position, there are no captures, so the MovePicker yields the
+///        quiet moves.
+TEST(MovePickerTest, MovePickerInitialPosition) {
+    Board<Glinski> b{"Test_MovePickerInitialPosition", true};
+
+    MovePicker<Glinski> picker{b};
+    Size count = 0;
+    while (OptMove optMove = picker.next()) {
+        ASSERT_FALSE(optMove.value().isCapture());
+        ++count;
+    }
+    ASSERT_EQ(count, 51);
+    ASSERT_EQ(picker.stage(), MovePicker<Glinski>::Stage::Done);
+}
+
+/// \brief Test: Over random games, the MovePicker yields each legal move exactly once,
+///        starting with the hash move if it is legal, then non-losing captures in MVV-LVA
+///        order. Hash and killer moves are also taken from the position two plies earlier
+///        (with the same mover), so that some are not legal, which exercises Board::isLegalMove.
+TEST(MovePickerTest, MovePickerYieldsEachLegalMoveOnce) {
+    Board<Glinski>::VariantMoveList prevLegalMoves{};   // One ply earlier
+    Board<Glinski>::VariantMoveList olderLegalMoves{};  // Two plies earlier
+    forEachRandomGamePosition(2021, 4, 80, [&](Board<Glinski>& b,
+        const Board<Glinski>::VariantMoveList& legalMoves, Short ply, std::mt19937& prng)
+    {
+        if (ply == 0) {  // A new game
+            prevLegalMoves.clear();
+            olderLegalMoves.clear();
+        }
+        const string fen = b.fen_string();
+        std::set<Move::Code> expected{};
+        for (const Move& move : legalMoves) {
+            expected.insert(move.code());
+        }
+        for (const Move& move : olderLegalMoves) {
+            ASSERT_EQ(b.isLegalMove(move), expected.contains(move.code())) << fen;
+        }
+        if (legalMoves.empty()) {
+            return;
+        }
+
+        // Hash move: Alternately from this position and from two plies earlier
+        const auto& hashSource = (ply % 2 == 0 || olderLegalMoves.empty()) ? legalMoves : olderLegalMoves;
+        OptMove optHashMove = hashSource[prng() % hashSource.size()];
+        MovePicker<Glinski>::Killers killers{};
+        if (!olderLegalMoves.empty()) {
+            killers[0] = olderLegalMoves[prng() % olderLegalMoves.size()];
+            killers[1] = legalMoves[prng() % legalMoves.size()];
+        }
+
+        MovePicker<Glinski> picker{b, optHashMove, killers};
+        std::set<Move::Code> actual{};
+        bool isPastGoodCaptures = false;
+        Value prevScore = std::numeric_limits<Value>::max();
+        Size count = 0;
+        while (OptMove optMove = picker.next()) {
+            const Move& move = optMove.value();
+            ASSERT_TRUE(actual.insert(move.code()).second) << fen;  // Not yielded before
+            if (count++ == 0 && expected.contains(optHashMove.value().code())) {
+                ASSERT_EQ(move, optHashMove.value()) << fen;
+                continue;
+            }
+            if (!move.isCapture()) {
+                isPastGoodCaptures = true;
+            } else if (!isPastGoodCaptures) {
+                Value score = MovePicker<Glinski>::captureScore(move);
+                ASSERT_LE(score, prevScore) << fen;
+                prevScore = score;
+            }
+        }
+        ASSERT_EQ(actual, expected) << fen;
+
+        olderLegalMoves = prevLegalMoves;
+        prevLegalMoves = legalMoves;
+    });
+}
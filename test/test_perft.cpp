@@ -0,0 +1,106 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <optional>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "board.h"
+#include "perft.h"
+#include "util_hexchess.h"
+#include "variant.h"
+
+using std::string;
+
+using hexchess::core::Board;
+using hexchess::core::Glinski;
+using hexchess::core::NodeCount;
+using hexchess::core::PerftHashTable;
+using hexchess::core::PerftReference;
+using hexchess::core::Short;
+
+using hexchess::core::divide;
+using hexchess::core::glinskiPerftReferences;
+using hexchess::core::perft;
+using hexchess::core::perftParallel;
+
+
+/// \brief Test: perft matches the reference counts, skipping the larger trees to keep the
+///        test fast, and leaves the Board unchanged.
+TEST(PerftTest, PerftReferenceCounts) {
+    constexpr NodeCount maxTestedCount = 2'000'000;
+    for (const PerftReference& ref : glinskiPerftReferences) {
+        Board<Glinski> b{"Test_PerftReferenceCounts", ref.fen};
+        const string fen = b.fen_string();
+        for (Short depth = 1; depth <= static_cast<Short>(ref.counts.size()); ++depth) {
+            const NodeCount expected = ref.counts[depth - 1];
+            if (expected > maxTestedCount) {
+                break;
+            }
+            ASSERT_EQ(perft(b, depth), expected) << ref.name << ", depth " << depth;
+            ASSERT_EQ(b.fen_string(), fen) << ref.name;
+        }
+    }
+}
+
+/// \brief Test: The counts from divide sum to the perft count, one per legal move.
+TEST(PerftTest, PerftDivideSumsToPerft) {
+    const PerftReference& ref = glinskiPerftReferences.at(0);
+    Board<Glinski> b{"Test_PerftDivideSumsToPerft", ref.fen};
+    for (Short depth = 1; depth <= 3; ++depth) {
+        const auto counts = divide(b, depth);
+        ASSERT_EQ(counts.size(), ref.counts[0]);
+        NodeCount total = 0;
+        for (const auto& [move, count] : counts) {
+            total += count;
+        }
+        ASSERT_EQ(total, ref.counts[depth - 1]);
+    }
+}
+
+/// \brief Test: A PerftHashTable returns what was stored, for the same depth only.
+TEST(PerftTest, PerftHashTableFindStore) {
+    PerftHashTable table{1};
+    ASSERT_FALSE(table.find(12345, 3).has_value());
+    table.store(12345, 3, 987'654'321);
+    ASSERT_EQ(table.find(12345, 3), std::make_optional<NodeCount>(987'654'321));
+    ASSERT_FALSE(table.find(12345, 4).has_value());
+    ASSERT_FALSE(table.find(12345 + table.size(), 3).has_value());  // Same slot, different key
+}
+
+/// \brief Test: Parallel perft, with and without a shared hash table, and split at
+///        depth 1 or 2, gives the same counts as the serial perft.
+TEST(PerftTest, PerftParallelMatchesSerial) {
+    constexpr NodeCount maxTestedCount = 2'000'000;
+    for (const PerftReference& ref : glinskiPerftReferences) {
+        Board<Glinski> b{"Test_PerftParallelMatchesSerial", ref.fen};
+        const string fen = b.fen_string();
+        PerftHashTable table{4};
+        for (Short depth = 1; depth <= static_cast<Short>(ref.counts.size()); ++depth) {
+            const NodeCount expected = ref.counts[depth - 1];
+            if (expected > maxTestedCount) {
+                break;
+            }
+            for (Short splitDepth : {1, 2}) {
+                ASSERT_EQ(perftParallel(b, depth, 4, nullptr, splitDepth), expected)
+                    << ref.name << ", depth " << depth;
+                ASSERT_EQ(perftParallel(b, depth, 4, &table, splitDepth), expected)
+                    << ref.name << ", depth " << depth;
+            }
+            ASSERT_EQ(b.fen_string(), fen) << ref.name;
+        }
+    }
+}
@@ -0,0 +1,156 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "board.h"
+#include "search.h"
+#include "transposition_table.h"
+#include "util_hexchess.h"
+#include "variant.h"
+
+using std::string;
+
+using hexchess::core::Board;
+using hexchess::core::Glinski;
+using hexchess::core::Move;
+using hexchess::core::NodeCount;
+using hexchess::core::Short;
+
+using hexchess::core::negInfinity;
+using hexchess::core::posInfinity;
+
+using hexchess::player::Bound;
+using hexchess::player::SearchLimits;
+using hexchess::player::SearchResult;
+using hexchess::player::StopRequest;
+using hexchess::player::TranspositionTable;
+
+using hexchess::player::searchAlphaBeta;
+using hexchess::player::searchIterativeDeepening;
+
+
+/// \brief Test: Without time or node limits, iterative deepening (with a transposition table)
+///        finds the same value as a single search at its final depth, and leaves the Board unchanged.
+TEST(SearchTest, SearchIterativeDeepeningMatchesFixedDepth) {
+    constexpr Short depth = 3;
+    Board<Glinski> b{"Test_SearchIterativeDeepeningMatchesFixedDepth"};
+    const string fen = b.fen_string();
+    const auto [optMove, value] = searchAlphaBeta(b, b.mover(), depth);
+
+    TranspositionTable table{1};
+    SearchLimits limits{};
+    limits.maxDepth = depth;
+    const SearchResult result = searchIterativeDeepening(b, b.mover(), limits, table);
+    ASSERT_EQ(result.depth, depth);
+    ASSERT_EQ(result.value, value);
+    ASSERT_TRUE(result.optMove.has_value());
+    ASSERT_TRUE(b.isLegalMove(result.optMove.value()));
+    ASSERT_EQ(b.fen_string(), fen);
+}
+
+/// \brief Test: A search stopped by a request from another thread, or by its node limit, still
+///        returns a legal move from a completed iteration, and stops within
+///        SearchLimits::NODES_PER_CHECK nodes.
+TEST(SearchTest, SearchIterativeDeepeningStops) {
+    Board<Glinski> b{"Test_SearchIterativeDeepeningStops"};
+    const string fen = b.fen_string();
+
+    StopRequest stop{};
+    SearchLimits stopLimits{};
+    stopLimits.optStop = &stop;
+    TranspositionTable table{1};
+    std::atomic<bool> isSearchDone{false};
+    std::thread stopper{[&]() {
+        while (!isSearchDone) {  // Requests made before the search starts are ignored.
+            stop.request();
+            std::this_thread::yield();
+        }
+    }};
+    SearchResult result = searchIterativeDeepening(b, b.mover(), stopLimits, table);
+    isSearchDone = true;
+    stopper.join();
+    ASSERT_GE(result.depth, 1);
+    ASSERT_LT(result.depth, stopLimits.maxDepth);
+    ASSERT_TRUE(result.optMove.has_value());
+    ASSERT_TRUE(b.isLegalMove(result.optMove.value()));
+    ASSERT_EQ(b.fen_string(), fen);
+
+    constexpr NodeCount maxNodes = 10'000;
+    SearchLimits nodeLimits{};
+    nodeLimits.optMaxNodes = maxNodes;
+    table.clear();
+    result = searchIterativeDeepening(b, b.mover(), nodeLimits, table);
+    ASSERT_GE(result.depth, 1);
+    ASSERT_LT(result.nodes, maxNodes + SearchLimits::NODES_PER_CHECK);
+    ASSERT_TRUE(result.optMove.has_value());
+    ASSERT_TRUE(b.isLegalMove(result.optMove.value()));
+    ASSERT_EQ(b.fen_string(), fen);
+}
+
+/// \brief Test: At the root, a table entry whose move is not legal (e.g., from a hash collision)
+///        does not settle the search, which would return an illegal move to be played.
+TEST(SearchTest, SearchIgnoresEntryWithIllegalMove) {
+    constexpr Short depth = 2;
+    Board<Glinski> b{"Test_SearchIgnoresEntryWithIllegalMove"};
+    const auto [optMove, value] = searchAlphaBeta(b, b.mover(), depth);
+
+    // A Black move is not legal with White to move.
+    Board<Glinski> other{"Test_SearchIgnoresEntryWithIllegalMove_Other"};
+    Board<Glinski>::VariantMoveList otherMoves{};
+    other.findLegalMoves(otherMoves, other.mover());
+    other.makeMove(otherMoves[0]);
+    otherMoves.clear();
+    other.findLegalMoves(otherMoves, other.mover());
+    const Move illegalMove = otherMoves[0];
+    ASSERT_FALSE(b.isLegalMove(illegalMove));
+
+    TranspositionTable table{1};
+    table.store(b.zobristHash(), depth + 1, Bound::Exact, value + 1'000, illegalMove);
+    const auto [optTableMove, tableValue] = searchAlphaBeta(
+        b, b.mover(), depth, negInfinity, posInfinity, true, 0, &table);
+    ASSERT_TRUE(optTableMove.has_value());
+    ASSERT_TRUE(b.isLegalMove(optTableMove.value()));
+    ASSERT_EQ(tableValue, value);
+}
+
+/// \brief Test: A stop requested while no search is in progress (before the first, or between
+///        two) is ignored, rather than cutting a later search short.
+TEST(SearchTest, SearchStopRequestIsScopedToOneSearch) {
+    constexpr Short depth = 3;
+    Board<Glinski> b{"Test_SearchStopRequestIsScopedToOneSearch"};
+    StopRequest stop{};
+    SearchLimits limits{};
+    limits.maxDepth = depth;
+    limits.optStop = &stop;
+    TranspositionTable table{1};
+
+    stop.request();
+    ASSERT_FALSE(stop.isRequested());
+    SearchResult result = searchIterativeDeepening(b, b.mover(), limits, table);
+    ASSERT_EQ(result.depth, depth);
+    ASSERT_GT(result.nodes, SearchLimits::NODES_PER_CHECK);  // The request was checked for
+
+    stop.request();
+    ASSERT_FALSE(stop.isRequested());
+    table.clear();
+    result = searchIterativeDeepening(b, b.mover(), limits, table);
+    ASSERT_EQ(result.depth, depth);
+    ASSERT_GT(result.nodes, SearchLimits::NODES_PER_CHECK);
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "slider_attacks.h"
+#include "util_hexchess.h"
+#include "variant.h"
+
+
+using hexchess::core::Glinski;
+using hexchess::core::Index;
+using hexchess::core::PieceType;
+using hexchess::core::Short;
+using hexchess::core::SliderAttacks;
+
+using SA = SliderAttacks<Glinski>;
+
+
+TEST(SliderAttacksTest, SliderAttacksEmptyBoard) {
+    Glinski::Bits empty{};
+    Short queenTotal = 0;
+    Short rookTotal = 0;
+    Short bishopTotal = 0;
+    for (Index from = 0; from < Glinski::CELL_COUNT; ++from) {
+        Glinski::Bits rook = SA::rookAttacks(from, empty);
+        Glinski::Bits bishop = SA::bishopAttacks(from, empty);
+        ASSERT_TRUE((rook & bishop).none());
+        ASSERT_EQ(SA::queenAttacks(from, empty), rook | bishop);
+        queenTotal += SA::queenAttacks(from, empty).count();
+        rookTotal += rook.count();
+        bishopTotal += bishop.count();
+    }
+    ASSERT_EQ(queenTotal, 3150);
+    ASSERT_EQ(rookTotal, 2070);
+    ASSERT_EQ(bishopTotal, 1080);
+}
+
+TEST(SliderAttacksTest, SliderAttacksMatchRayWalk) {
+    std::mt19937_64 prng{12345};
+    for (Short trial = 0; trial < 200; ++trial) {
+        // Sparse and dense occupancies
+        Glinski::Bits occupancy = trial % 2
+            ? Glinski::Bits{prng() & prng(), prng() & prng()}
+            : Glinski::Bits{prng() | prng(), prng() | prng()};
+        for (Index from = 0; from < Glinski::CELL_COUNT; ++from) {
+            Glinski::Bits rook{};
+            Glinski::Bits bishop{};
+            for (Short line = 0; line < SA::LINE_COUNT; ++line) {
+                Glinski::Bits lineAttacks = SA::slowLineAttacks(from, line, occupancy);
+                (line < SA::ORTHO_LINE_COUNT ? rook : bishop) |= lineAttacks;
+            }
+            ASSERT_EQ(SA::attacks(PieceType::Rook, from, occupancy), rook);
+            ASSERT_EQ(SA::attacks(PieceType::Bishop, from, occupancy), bishop);
+            ASSERT_EQ(SA::attacks(PieceType::Queen, from, occupancy), rook | bishop);
+        }
+    }
+}
+
+TEST(SliderAttacksTest, SliderMagicsAreValid) {
+    // The generated magics must work even in builds that index with pext.
+    for (Index from = 0; from < Glinski::CELL_COUNT; ++from) {
+        for (Short line = 0; line < SA::LINE_COUNT; ++line) {
+            Glinski::Bits mask = SA::relevantMask(from, line);
+            ASSERT_LE(mask.count(), 9);
+            ASSERT_TRUE(SA::isValidMagicLane(mask.lo(), SA::magics()[from][line].lo));
+            ASSERT_TRUE(SA::isValidMagicLane(mask.hi(), SA::magics()[from][line].hi));
+        }
+    }
+    ASSERT_THROW(SA::attacks(PieceType::Knight, 0, Glinski::Bits{}), std::logic_error);
+}
@@ -0,0 +1,105 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <optional>
+
+#include <gtest/gtest.h>
+
+#include "board.h"
+#include "move.h"
+#include "transposition_table.h"
+#include "util_hexchess.h"
+#include "variant.h"
+
+using hexchess::core::Board;
+using hexchess::core::Glinski;
+using hexchess::core::Move;
+using hexchess::core::OptMove;
+using hexchess::core::Short;
+using hexchess::core::ZHash;
+
+using hexchess::player::Bound;
+using hexchess::player::TranspositionEntry;
+using hexchess::player::TranspositionTable;
+
+
+/// \brief Returns a hash whose low bits (the bucket) are \p bucket, and whose high bits
+///        (checked on probe) are \p check.
+static ZHash hashOf(ZHash check, ZHash bucket) { return (check << 32) | bucket; }
+
+/// \brief Test: An entry is found by its own hash (with its move, if any), and not by a hash
+///        that selects the same bucket, but differs in its high bits.
+TEST(TranspositionTableTest, TranspositionTableProbeStore) {
+    Board<Glinski> b{"Test_TranspositionTableProbeStore"};
+    Board<Glinski>::VariantMoveList moves{};
+    b.findLegalMoves(moves, b.mover());
+    ASSERT_GE(moves.size(), 2u);
+
+    TranspositionTable table{1};
+    ASSERT_EQ(table.size() & (table.size() - 1), 0u);  // A power of 2
+    ASSERT_FALSE(table.probe(hashOf(1, 7)).has_value());
+
+    table.store(hashOf(1, 7), 3, Bound::Lower, 42, moves[0]);
+    std::optional<TranspositionEntry> optEntry = table.probe(hashOf(1, 7));
+    ASSERT_TRUE(optEntry.has_value());
+    ASSERT_EQ(optEntry->optMove, OptMove{moves[0]});
+    ASSERT_EQ(optEntry->depth, 3);
+    ASSERT_EQ(optEntry->bound, Bound::Lower);
+    ASSERT_EQ(optEntry->value, 42);
+    ASSERT_FALSE(table.probe(hashOf(2, 7)).has_value());
+
+    // Updating the same position without a move keeps the old move.
+    table.store(hashOf(1, 7), 4, Bound::Upper, -5, std::nullopt);
+    optEntry = table.probe(hashOf(1, 7));
+    ASSERT_EQ(optEntry->optMove, OptMove{moves[0]});
+    ASSERT_EQ(optEntry->depth, 4);
+    ASSERT_EQ(optEntry->bound, Bound::Upper);
+    ASSERT_EQ(optEntry->value, -5);
+
+    table.clear();
+    ASSERT_FALSE(table.probe(hashOf(1, 7)).has_value());
+}
+
+/// \brief Test: Once a bucket's depth-preferred entries are full, a shallower search goes to
+///        the always-replace entry, while a deeper one replaces the shallowest entry.
+///        In a new search, entries from earlier searches are replaced first.
+TEST(TranspositionTableTest, TranspositionTableReplacement) {
+    TranspositionTable table{1};
+    table.store(hashOf(1, 3), 5, Bound::Exact, 1, std::nullopt);
+    table.store(hashOf(2, 3), 6, Bound::Exact, 2, std::nullopt);
+    table.store(hashOf(3, 3), 7, Bound::Exact, 3, std::nullopt);
+
+    // Shallower: Each replaces the previous one in the always-replace entry.
+    table.store(hashOf(4, 3), 1, Bound::Exact, 4, std::nullopt);
+    ASSERT_TRUE(table.probe(hashOf(4, 3)).has_value());
+    table.store(hashOf(5, 3), 2, Bound::Exact, 5, std::nullopt);
+    ASSERT_FALSE(table.probe(hashOf(4, 3)).has_value());
+    ASSERT_TRUE(table.probe(hashOf(5, 3)).has_value());
+    for (ZHash check = 1; check <= 3; ++check) {
+        ASSERT_TRUE(table.probe(hashOf(check, 3)).has_value());
+    }
+
+    // Deeper: The shallowest depth-preferred entry is replaced.
+    table.store(hashOf(6, 3), 8, Bound::Exact, 6, std::nullopt);
+    ASSERT_TRUE(table.probe(hashOf(6, 3)).has_value());
+    ASSERT_FALSE(table.probe(hashOf(1, 3)).has_value());
+    ASSERT_TRUE(table.probe(hashOf(5, 3)).has_value());
+
+    // New search: Even a shallow search replaces an entry from an earlier search.
+    table.newSearch();
+    table.store(hashOf(7, 3), 1, Bound::Exact, 7, std::nullopt);
+    ASSERT_TRUE(table.probe(hashOf(7, 3)).has_value());
+    ASSERT_TRUE(table.probe(hashOf(5, 3)).has_value());  // Always-replace entry untouched
+}
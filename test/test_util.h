@@ -0,0 +1,66 @@
+// Copyright (C) 2021, by Jay M. Coskey
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstdint>
+
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "board.h"
+#include "util_hexchess.h"
+#include "variant.h"
+
+
+namespace hexchess::test {
+
+using core::Board;
+using core::Glinski;
+using core::Short;
+
+/// \brief Plays \p gameCount games of up to \p plyCount random legal moves each, from the
+///        initial position, calling \p fn at each position reached (including the last),
+///        before the next move is chosen.
+///
+/// \p fn is called as fn(b, legalMoves, ply, prng). It may use \p prng (which also chooses the
+/// moves, so the games depend on its use), and may change \p b only by moves it takes back.
+/// Play stops at the first fatal test failure, so \p fn may use ASSERT_*.
+template <typename Fn>
+void forEachRandomGamePosition(std::uint32_t seed, Short gameCount, Short plyCount, Fn fn,
+                               bool isTrackingAttacks=false)
+{
+    std::mt19937 prng{seed};
+    for (Short game = 0; game < gameCount; ++game) {
+        Board<Glinski> b{"Test_RandomGame_" + std::to_string(game), true};
+        b.setIsTrackingAttacks(isTrackingAttacks);
+        for (Short ply = 0; ply < plyCount; ++ply) {
+            Board<Glinski>::VariantMoveList legalMoves{};
+            b.findLegalMoves(legalMoves, b.mover());
+            fn(b, legalMoves, ply, prng);
+            if (::testing::Test::HasFatalFailure()) {
+                return;
+            }
+            if (legalMoves.empty()) {
+                break;
+            }
+            b.moveExec(legalMoves[prng() % legalMoves.size()]);
+        }
+    }
+}
+
+}  // namespace hexchess::test
@@ -18,7 +18,9 @@
 
 #include <gtest/gtest.h>
 
+#include "board.h"
 #include "fen.h"
+#include "move.h"
 #include "util_hexchess.h"
 #include "variant.h"
 #include "zobrist.h"
@@ -26,10 +28,13 @@
 using std::cout;
 using std::string;
 
+using hexchess::core::Board;
 using hexchess::core::Color;
 using hexchess::core::Fen;
 using hexchess::core::Glinski;
 using hexchess::core::Index;
+using hexchess::core::Move;
+using hexchess::core::MoveEnum;
 using hexchess::core::PiecesSparse;
 using hexchess::core::PieceType;
 using hexchess::core::Size;
@@ -37,6 +42,7 @@ using hexchess::core::ZHash;
 using hexchess::core::ZIndex;
 using hexchess::core::Zobrist;
 
+using hexchess::core::colorIndex;
 using hexchess::core::piece_fen_string;
 using hexchess::core::piece_type_string;
 using hexchess::core::randomBitstring;
@@ -132,3 +138,28 @@ TEST(ZobristTest, ZobristInitialBoard) {
     }
     assert(boardHash == 0x712bf5ea63571cf5);
 }
+
+/// \brief Test: The incrementally maintained Board hash tracks the side to move and the
+///        en passant cell, matches a full recompute, and is restored by moveUndo.
+TEST(ZobristTest, ZobristIncrementalBoard) {
+    Board<Glinski> b{"Test_ZobristIncrementalBoard", true};
+    ZHash initialHash = b.zobristHash();
+    ASSERT_EQ(initialHash, b.zobristHashRecompute());
+
+    Index from = 37;
+    Index to = Glinski::pawnPush2[colorIndex(Color::White)][from].lsb();
+    Move move{Color::White, PieceType::Pawn, from, to, MoveEnum::Simple,
+              std::nullopt, std::nullopt, std::nullopt};
+    b.moveExec(move);
+    ASSERT_EQ(b.zobristHash(), b.zobristHashRecompute());
+
+    ZHash expectedHash = initialHash
+        ^ Zobrist<Glinski>::getZHash(from, Color::White, PieceType::Pawn)
+        ^ Zobrist<Glinski>::getZHash(to, Color::White, PieceType::Pawn)
+        ^ Zobrist<Glinski>::getMoverZHash(Color::Black)
+        ^ Zobrist<Glinski>::getEpZHash(Glinski::average(from, to));
+    ASSERT_EQ(b.zobristHash(), expectedHash);
+
+    b.moveUndo(move);
+    ASSERT_EQ(b.zobristHash(), initialHash);
+}